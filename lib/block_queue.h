@@ -0,0 +1,84 @@
+#ifndef BLOCK_QUEUE_H
+#define BLOCK_QUEUE_H
+
+#include <stdlib.h>
+#include <pthread.h>
+
+/**
+ * @brief スレッド間でポインタを受け渡す有界キュー
+ *
+ * 中身はコピーせずポインタだけを渡す。満杯なら push が、空なら pop が待つ。
+ * block_queue_close 後、空になった時点で pop は NULL を返す（終端の通知）。
+ */
+typedef struct {
+    void **items;
+    int capacity;
+    int head;
+    int count;
+    int closed;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+} block_queue;
+
+static inline int block_queue_init(block_queue *q, int capacity)
+{
+    q->items = (void **)calloc(capacity, sizeof(void *));
+    if (!q->items)
+        return -1;
+    q->capacity = capacity;
+    q->head = 0;
+    q->count = 0;
+    q->closed = 0;
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->not_empty, NULL);
+    pthread_cond_init(&q->not_full, NULL);
+    return 0;
+}
+
+static inline void block_queue_destroy(block_queue *q)
+{
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->not_empty);
+    pthread_cond_destroy(&q->not_full);
+    free(q->items);
+    q->items = NULL;
+}
+
+static inline void block_queue_push(block_queue *q, void *item)
+{
+    pthread_mutex_lock(&q->lock);
+    while (q->count == q->capacity)
+        pthread_cond_wait(&q->not_full, &q->lock);
+    q->items[(q->head + q->count) % q->capacity] = item;
+    q->count++;
+    pthread_cond_signal(&q->not_empty);
+    pthread_mutex_unlock(&q->lock);
+}
+
+static inline void *block_queue_pop(block_queue *q)
+{
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0 && !q->closed)
+        pthread_cond_wait(&q->not_empty, &q->lock);
+    void *item = NULL;
+    if (q->count > 0) {
+        item = q->items[q->head];
+        q->head = (q->head + 1) % q->capacity;
+        q->count--;
+        pthread_cond_signal(&q->not_full);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return item;
+}
+
+// これ以上 push しないことを通知する
+static inline void block_queue_close(block_queue *q)
+{
+    pthread_mutex_lock(&q->lock);
+    q->closed = 1;
+    pthread_cond_broadcast(&q->not_empty);
+    pthread_mutex_unlock(&q->lock);
+}
+
+#endif // BLOCK_QUEUE_H
@@ -0,0 +1,113 @@
+#ifndef FFT_FIXED_H
+#define FFT_FIXED_H
+
+#include <math.h>
+
+#include "fft_radix2.h"      // テーブル参照の基数2 FFT 本体
+#include "fft_tables_1024.h" // tools/gen_fft_tables.c で生成したテーブル
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * @brief 長さを実行時に指定する基数2 FFT（汎用版）
+ *
+ * @param n 変換長（2のべき乗）
+ * @param xr 実部の配列ポインタ（変換結果で上書きされる）
+ * @param xi 虚部の配列ポインタ（変換結果で上書きされる）
+ * @param inverse 0なら順変換、0以外なら逆変換（1/nでスケーリング）
+ * @return 成功なら0、nが2のべき乗でないかテーブルを作れなければ-1
+ *
+ * 課題3のDFTと同じ符号・スケーリング規約（順変換は e^{-j2πkn/N}）。
+ * 回転因子とビット反転のテーブルはスレッドごとに1つ保持し、
+ * 前回と長さが変わったときだけ作り直す（プログラム終了まで解放しない）。
+ */
+static inline int fft_runtime(int n, double *xr, double *xi, int inverse)
+{
+    static _Thread_local fft_table table;
+    if (n < 1 || (n & (n - 1)) != 0)
+        return -1;
+    if (table.n != n) {
+        fft_table_free(&table);
+        if (fft_table_init(&table, n) != 0)
+            return -1;
+    }
+
+    fft_table_run(&table, xr, xi, inverse ? 1.0 : -1.0);
+
+    if (inverse) {
+        for (int i = 0; i < n; i++) {
+            xr[i] /= n;
+            xi[i] /= n;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief ハミング窓を先頭L点に掛ける（汎用版）
+ */
+static inline void hamming_window(double *x, int L)
+{
+    for (int n = 0; n < L; n++) {
+        double w = 0.54 - 0.46 * cos(2.0 * M_PI * n / (L - 1));
+        x[n] *= w;
+    }
+}
+
+/**
+ * @brief 固定長FFTの関数群を生成するマクロ
+ *
+ * @param NAME 生成する関数名の接頭辞
+ * @param T サンプル型（float または double）
+ * @param N 変換長（2のべき乗、4以上）
+ * @param COS_INIT, SIN_INIT, REV_INIT, WIN_INIT gen_fft_tables が出力したテーブル
+ *
+ * 生成される関数:
+ *   NAME(xr, xi)              順変換
+ *   NAME##_inverse(xr, xi)    逆変換（1/Nでスケーリング）
+ *   NAME##_apply_window(x)    長さNのハミング窓を掛ける
+ *
+ * 回転因子・ビット反転・窓はコンパイル時の定数テーブルとして埋め込む。
+ * 本体は汎用版と同じ fft_radix2.h の共通実装。
+ */
+#define FFT_FIXED_DEFINE(NAME, T, N, COS_INIT, SIN_INIT, REV_INIT, WIN_INIT)       \
+    static const T NAME##_cos[(N) / 2] = COS_INIT;                                 \
+    static const T NAME##_sin[(N) / 2] = SIN_INIT;                                 \
+    static const int NAME##_rev[N] = REV_INIT;                                     \
+    static const T NAME##_window[N] = WIN_INIT;                                    \
+                                                                                   \
+    static inline void NAME##_core(T *xr, T *xi, T sign)                           \
+    {                                                                              \
+        _Generic((xr), float *: fft_radix2f, default: fft_radix2)(                 \
+            (N), NAME##_cos, NAME##_sin, NAME##_rev, xr, xi, sign);                \
+    }                                                                              \
+                                                                                   \
+    static inline void NAME(T *xr, T *xi)                                          \
+    {                                                                              \
+        NAME##_core(xr, xi, (T)-1);                                                \
+    }                                                                              \
+                                                                                   \
+    static inline void NAME##_inverse(T *xr, T *xi)                                \
+    {                                                                              \
+        NAME##_core(xr, xi, (T)1);                                                 \
+        for (int i = 0; i < (N); i++) {                                            \
+            xr[i] *= (T)1 / (N);                                                   \
+            xi[i] *= (T)1 / (N);                                                   \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void NAME##_apply_window(T *x)                                   \
+    {                                                                              \
+        for (int i = 0; i < (N); i++)                                              \
+            x[i] *= NAME##_window[i];                                              \
+    }
+
+// 課題4・課題7で使う1024点版（double / float）
+FFT_FIXED_DEFINE(fft1024, double, 1024, FFT_TABLE_1024_COS, FFT_TABLE_1024_SIN,
+                 FFT_TABLE_1024_REV, FFT_TABLE_1024_HAMMING)
+FFT_FIXED_DEFINE(fft1024f, float, 1024, FFT_TABLE_1024_COS, FFT_TABLE_1024_SIN,
+                 FFT_TABLE_1024_REV, FFT_TABLE_1024_HAMMING)
+
+#endif // FFT_FIXED_H
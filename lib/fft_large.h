@@ -0,0 +1,211 @@
+#ifndef FFT_LARGE_H
+#define FFT_LARGE_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "thread_pool.h"
+#include "fft_radix2.h" // 行FFT（汎用版と共通の基数2 FFT）
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*
+ * 大きなサイズ（2^16〜2^24点程度）向けの six-step FFT
+ *
+ * N = N1 × N2 として、
+ *   1. 転置（N2×N1 → N1×N2）  2. 長さN2のFFTをN1本  3. 回転因子 W_N^(n1 k2) を掛ける
+ *   4. 転置                    5. 長さN1のFFTをN2本  6. 転置
+ * の順に計算する。各行のFFTはL1/L2キャッシュに収まる長さになり、
+ * 転置は32×32のタイル単位で行う。行の処理はスレッドプールで分担する。
+ * 符号・スケーリングは課題3のDFT/IDFTと同じ。
+ */
+
+#define FFT_LARGE_ALIGN 64 // キャッシュライン境界
+#define FFT_LARGE_TILE 32  // 転置のタイル幅
+
+typedef struct {
+    int n, n1, n2;
+    fft_table row1, row2;     // 行FFTのテーブル（長さ n1, n2）
+    int lo_bits;              // W_N^e = lo[e の下位 lo_bits] × hi[e の上位]
+    double *lo_re, *lo_im, *hi_re, *hi_im;
+    double *work_re, *work_im; // 転置用の作業領域（n点）
+    thread_pool *pool;
+} fft_large_plan;
+
+/**
+ * @brief 64バイト境界にそろえた double 配列を確保する（free で解放）
+ */
+static inline double *fft_large_alloc(size_t n)
+{
+    void *p = NULL;
+    if (posix_memalign(&p, FFT_LARGE_ALIGN, n * sizeof(double)) != 0)
+        return NULL;
+    return (double *)p;
+}
+
+// src（rows × cols）を転置して dst（cols × rows）の行 [d0, d1) を埋める
+static inline void fft_large_transpose(const double *src, double *dst, int rows, int cols, int d0, int d1)
+{
+    for (int db = d0; db < d1; db += FFT_LARGE_TILE) {
+        int de = db + FFT_LARGE_TILE < d1 ? db + FFT_LARGE_TILE : d1;
+        for (int sb = 0; sb < rows; sb += FFT_LARGE_TILE) {
+            int se = sb + FFT_LARGE_TILE < rows ? sb + FFT_LARGE_TILE : rows;
+            for (int d = db; d < de; d++) {
+                for (int s = sb; s < se; s++)
+                    dst[(size_t)d * rows + s] = src[(size_t)s * cols + d];
+            }
+        }
+    }
+}
+
+// スレッドごとの仕事
+typedef struct {
+    fft_large_plan *p;
+    double *re, *im;
+    double sign;
+    int phase;
+} fft_large_job;
+
+static inline void fft_large_worker(void *arg, int id, int nthreads)
+{
+    fft_large_job *job = (fft_large_job *)arg;
+    fft_large_plan *p = job->p;
+    const int n1 = p->n1, n2 = p->n2;
+    const int lo_mask = (1 << p->lo_bits) - 1;
+
+    switch (job->phase) {
+    case 0: {
+        // 1〜3: x（n2行×n1列）→ work（n1行×n2列）、各行FFT、回転因子
+        int r0 = (int)((long)n1 * id / nthreads), r1 = (int)((long)n1 * (id + 1) / nthreads);
+        fft_large_transpose(job->re, p->work_re, n2, n1, r0, r1);
+        fft_large_transpose(job->im, p->work_im, n2, n1, r0, r1);
+        for (int n = r0; n < r1; n++) {
+            double *re = p->work_re + (size_t)n * n2, *im = p->work_im + (size_t)n * n2;
+            fft_table_run(&p->row2, re, im, job->sign);
+            for (int k = 1; k < n2; k++) {
+                long e = (long)n * k; // < N
+                double ar = p->lo_re[e & lo_mask], ai = p->lo_im[e & lo_mask];
+                double br = p->hi_re[e >> p->lo_bits], bi = p->hi_im[e >> p->lo_bits];
+                double wr = ar * br - ai * bi;
+                double wi = job->sign * (ar * bi + ai * br);
+                double xr = re[k];
+                re[k] = xr * wr - im[k] * wi;
+                im[k] = xr * wi + im[k] * wr;
+            }
+        }
+        break;
+    }
+    case 1: {
+        // 4〜5: work（n1行×n2列）→ x（n2行×n1列）、各行FFT
+        int r0 = (int)((long)n2 * id / nthreads), r1 = (int)((long)n2 * (id + 1) / nthreads);
+        fft_large_transpose(p->work_re, job->re, n1, n2, r0, r1);
+        fft_large_transpose(p->work_im, job->im, n1, n2, r0, r1);
+        for (int k = r0; k < r1; k++)
+            fft_table_run(&p->row1, job->re + (size_t)k * n1, job->im + (size_t)k * n1, job->sign);
+        break;
+    }
+    case 2: {
+        // 6: x（n2行×n1列）→ work（n1行×n2列）
+        int r0 = (int)((long)n1 * id / nthreads), r1 = (int)((long)n1 * (id + 1) / nthreads);
+        fft_large_transpose(job->re, p->work_re, n2, n1, r0, r1);
+        fft_large_transpose(job->im, p->work_im, n2, n1, r0, r1);
+        break;
+    }
+    default: {
+        // work を x に書き戻す（逆変換なら 1/N を掛ける）
+        size_t i0 = (size_t)p->n * id / nthreads, i1 = (size_t)p->n * (id + 1) / nthreads;
+        if (job->sign > 0) {
+            double scale = 1.0 / p->n;
+            for (size_t i = i0; i < i1; i++) {
+                job->re[i] = p->work_re[i] * scale;
+                job->im[i] = p->work_im[i] * scale;
+            }
+        } else {
+            memcpy(job->re + i0, p->work_re + i0, (i1 - i0) * sizeof(double));
+            memcpy(job->im + i0, p->work_im + i0, (i1 - i0) * sizeof(double));
+        }
+        break;
+    }
+    }
+}
+
+static inline void fft_large_plan_destroy(fft_large_plan *p)
+{
+    if (!p)
+        return;
+    fft_table_free(&p->row1);
+    fft_table_free(&p->row2);
+    free(p->lo_re);
+    free(p->lo_im);
+    free(p->hi_re);
+    free(p->hi_im);
+    free(p->work_re);
+    free(p->work_im);
+    thread_pool_destroy(p->pool);
+    free(p);
+}
+
+/**
+ * @brief six-step FFT の計画（テーブル・作業領域・スレッド）を作る
+ *
+ * @param n 変換長（2のべき乗、4以上）
+ * @param nthreads 使うスレッド数（0以下ならコア数）
+ * @return 失敗時（nが2のべき乗でない、メモリ不足）は NULL
+ */
+static inline fft_large_plan *fft_large_plan_create(int n, int nthreads)
+{
+    if (n < 4 || (n & (n - 1)) != 0)
+        return NULL;
+    int bits = 0;
+    while ((1 << bits) < n)
+        bits++;
+
+    fft_large_plan *p = (fft_large_plan *)calloc(1, sizeof(fft_large_plan));
+    if (!p)
+        return NULL;
+    p->n = n;
+    p->n1 = 1 << (bits / 2);
+    p->n2 = n / p->n1;
+    p->lo_bits = (bits + 1) / 2;
+    int lo_n = 1 << p->lo_bits, hi_n = n >> p->lo_bits;
+
+    p->lo_re = fft_large_alloc(lo_n);
+    p->lo_im = fft_large_alloc(lo_n);
+    p->hi_re = fft_large_alloc(hi_n);
+    p->hi_im = fft_large_alloc(hi_n);
+    p->work_re = fft_large_alloc(n);
+    p->work_im = fft_large_alloc(n);
+    p->pool = thread_pool_create(nthreads);
+    if (fft_table_init(&p->row1, p->n1) != 0 || fft_table_init(&p->row2, p->n2) != 0 ||
+        !p->lo_re || !p->lo_im || !p->hi_re || !p->hi_im || !p->work_re || !p->work_im || !p->pool) {
+        fft_large_plan_destroy(p);
+        return NULL;
+    }
+
+    // W_N^e = e^{j2πe/N}（符号は実行時に掛ける）
+    for (int i = 0; i < lo_n; i++) {
+        p->lo_re[i] = cos(2.0 * M_PI * i / n);
+        p->lo_im[i] = sin(2.0 * M_PI * i / n);
+    }
+    for (int i = 0; i < hi_n; i++) {
+        p->hi_re[i] = cos(2.0 * M_PI * ((double)i * lo_n) / n);
+        p->hi_im[i] = sin(2.0 * M_PI * ((double)i * lo_n) / n);
+    }
+    return p;
+}
+
+/**
+ * @brief 計画 p に従ってFFTを行う（re, im を上書き）
+ *
+ * @param inverse 0なら順変換、0以外なら逆変換（1/Nでスケーリング）
+ */
+static inline void fft_large(fft_large_plan *p, double *re, double *im, int inverse)
+{
+    fft_large_job job = {p, re, im, inverse ? 1.0 : -1.0, 0};
+    for (job.phase = 0; job.phase < 4; job.phase++)
+        thread_pool_run(p->pool, fft_large_worker, &job);
+}
+
+#endif // FFT_LARGE_H
@@ -0,0 +1,142 @@
+#ifndef FFT_RADIX2_H
+#define FFT_RADIX2_H
+
+#include <stdlib.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*
+ * テーブル参照の基数2 FFT（固定長版・汎用版・six-step の行FFTで共用する本体）
+ *
+ * 回転因子 cos_tab[k] = cos(2πk/n), sin_tab[k] = sin(2πk/n)（k < n/2）と
+ * ビット反転順序 rev[] を呼び出し側が用意する。
+ * fft_fixed.h はコンパイル時の定数テーブルを、汎用版と six-step は
+ * fft_table_init で実行時に作ったテーブルを渡す。
+ */
+
+/**
+ * @brief 基数2 FFT の本体を型 T について生成するマクロ
+ *
+ * 生成される関数: NAME(n, cos_tab, sin_tab, rev, xr, xi, sign)
+ *   sign = -1 で順変換、+1 で逆変換（スケーリングなし）。n は2のべき乗。
+ * 最初の2段（基数2×2 = 基数4）は回転因子が 1 と ∓j だけなのでまとめて展開してある。
+ */
+#define FFT_RADIX2_DEFINE(NAME, T)                                                 \
+    static inline void NAME(int n, const T *cos_tab, const T *sin_tab,             \
+                            const int *rev, T *xr, T *xi, T sign)                  \
+    {                                                                              \
+        for (int i = 0; i < n; i++) {                                              \
+            int j = rev[i];                                                        \
+            if (i < j) {                                                           \
+                T t = xr[i]; xr[i] = xr[j]; xr[j] = t;                             \
+                t = xi[i]; xi[i] = xi[j]; xi[j] = t;                               \
+            }                                                                      \
+        }                                                                          \
+        if (n < 4) {                                                               \
+            if (n == 2) {                                                          \
+                T tr = xr[1], ti = xi[1];                                          \
+                xr[1] = xr[0] - tr; xi[1] = xi[0] - ti;                            \
+                xr[0] += tr; xi[0] += ti;                                          \
+            }                                                                      \
+            return;                                                                \
+        }                                                                          \
+        /* 第1・第2段: 回転因子は 1 と ∓j だけなので乗算なしで展開 */              \
+        for (int i = 0; i < n; i += 4) {                                           \
+            T ar = xr[i] + xr[i + 1], ai = xi[i] + xi[i + 1];                      \
+            T br = xr[i] - xr[i + 1], bi = xi[i] - xi[i + 1];                      \
+            T cr = xr[i + 2] + xr[i + 3], ci = xi[i + 2] + xi[i + 3];              \
+            T dr = xr[i + 2] - xr[i + 3], di = xi[i + 2] - xi[i + 3];              \
+            T tr = -sign * di, ti = sign * dr;                                     \
+            xr[i] = ar + cr; xi[i] = ai + ci;                                      \
+            xr[i + 2] = ar - cr; xi[i + 2] = ai - ci;                              \
+            xr[i + 1] = br + tr; xi[i + 1] = bi + ti;                              \
+            xr[i + 3] = br - tr; xi[i + 3] = bi - ti;                              \
+        }                                                                          \
+        for (int len = 8; len <= n; len <<= 1) {                                   \
+            int half = len / 2;                                                    \
+            int step = n / len;                                                    \
+            for (int i = 0; i < n; i += len) {                                     \
+                for (int k = 0; k < half; k++) {                                   \
+                    T wr = cos_tab[k * step];                                      \
+                    T wi = sign * sin_tab[k * step];                               \
+                    T *pr = xr + i + k, *pi = xi + i + k;                          \
+                    T vr = pr[half] * wr - pi[half] * wi;                          \
+                    T vi = pr[half] * wi + pi[half] * wr;                          \
+                    pr[half] = pr[0] - vr;                                         \
+                    pi[half] = pi[0] - vi;                                         \
+                    pr[0] += vr;                                                   \
+                    pi[0] += vi;                                                   \
+                }                                                                  \
+            }                                                                      \
+        }                                                                          \
+    }
+
+FFT_RADIX2_DEFINE(fft_radix2, double)
+FFT_RADIX2_DEFINE(fft_radix2f, float)
+
+// 実行時に作る長さnのテーブル
+typedef struct {
+    int n;
+    double *cos_tab; // cos(2πk/n), k < n/2
+    double *sin_tab;
+    int *rev;        // ビット反転順序
+} fft_table;
+
+static inline void fft_table_free(fft_table *t)
+{
+    free(t->cos_tab);
+    free(t->sin_tab);
+    free(t->rev);
+    t->n = 0;
+    t->cos_tab = t->sin_tab = NULL;
+    t->rev = NULL;
+}
+
+/**
+ * @brief 長さnのテーブルを作る（fft_table_free で解放）
+ * @return 成功なら0、nが2のべき乗でないかメモリ不足なら-1
+ */
+static inline int fft_table_init(fft_table *t, int n)
+{
+    t->n = 0;
+    t->cos_tab = t->sin_tab = NULL;
+    t->rev = NULL;
+    if (n < 1 || (n & (n - 1)) != 0)
+        return -1;
+    int bits = 0;
+    while ((1 << bits) < n)
+        bits++;
+    int half = n / 2 > 0 ? n / 2 : 1;
+    t->cos_tab = (double *)malloc(sizeof(double) * half);
+    t->sin_tab = (double *)malloc(sizeof(double) * half);
+    t->rev = (int *)malloc(sizeof(int) * n);
+    if (!t->cos_tab || !t->sin_tab || !t->rev) {
+        fft_table_free(t);
+        return -1;
+    }
+    for (int k = 0; k < n / 2; k++) {
+        t->cos_tab[k] = cos(2.0 * M_PI * k / n);
+        t->sin_tab[k] = sin(2.0 * M_PI * k / n);
+    }
+    for (int i = 0; i < n; i++) {
+        int j = 0;
+        for (int b = 0; b < bits; b++) {
+            if (i & (1 << b))
+                j |= 1 << (bits - 1 - b);
+        }
+        t->rev[i] = j;
+    }
+    t->n = n;
+    return 0;
+}
+
+// テーブル t でFFTを行う（sign = -1 で順変換、+1 で逆変換。スケーリングなし）
+static inline void fft_table_run(const fft_table *t, double *xr, double *xi, double sign)
+{
+    fft_radix2(t->n, t->cos_tab, t->sin_tab, t->rev, xr, xi, sign);
+}
+
+#endif // FFT_RADIX2_H
@@ -0,0 +1,598 @@
+// このファイルは tools/gen_fft_tables.c で生成（手で編集しないこと）
+// 使い方: ./gen_fft_tables 1024 > fft_tables_1024.h
+#ifndef FFT_TABLES_1024_H
+#define FFT_TABLES_1024_H
+
+#define FFT_TABLE_1024_COS \
+    { \
+        1, 0.99998117528260111, 0.9999247018391445, 0.9998305817958234, \
+        0.99969881869620425, 0.99952941750109314, 0.99932238458834954, 0.99907772775264536, \
+        0.99879545620517241, 0.99847558057329477, 0.99811811290014918, 0.99772306664419164, \
+        0.99729045667869021, 0.99682029929116567, 0.996312612182778, 0.99576741446765982, \
+        0.99518472667219693, 0.99456457073425542, 0.99390697000235606, 0.9932119492347945, \
+        0.99247953459870997, 0.99170975366909953, 0.99090263542778001, 0.99005821026229712, \
+        0.98917650996478101, 0.98825756773074946, 0.98730141815785843, 0.98630809724459867, \
+        0.98527764238894122, 0.98421009238692903, 0.98310548743121629, 0.98196386910955524, \
+        0.98078528040323043, 0.97956976568544052, 0.97831737071962765, 0.97702814265775439, \
+        0.97570213003852857, 0.97433938278557586, 0.97293995220556018, 0.97150389098625178, \
+        0.97003125319454397, 0.96852209427441738, 0.96697647104485207, 0.9653944416976894, \
+        0.96377606579543984, 0.96212140426904158, 0.96043051941556579, 0.9587034748958716, \
+        0.95694033573220882, 0.95514116830577078, 0.95330604035419386, 0.95143502096900834, \
+        0.94952818059303667, 0.94758559101774109, 0.94560732538052128, 0.94359345816196039, \
+        0.94154406518302081, 0.93945922360218992, 0.93733901191257496, 0.93518350993894761, \
+        0.93299279883473896, 0.93076696107898371, 0.92850608047321559, 0.92621024213831138, \
+        0.92387953251128674, 0.92151403934204201, 0.91911385169005777, 0.9166790599210427, \
+        0.91420975570353069, 0.91170603200542988, 0.90916798309052238, 0.90659570451491533, \
+        0.90398929312344334, 0.90134884704602203, 0.89867446569395382, 0.89596624975618522, \
+        0.89322430119551532, 0.89044872324475788, 0.88763962040285393, 0.88479709843093779, \
+        0.88192126434835505, 0.87901222642863353, 0.8760700941954066, 0.87309497841829009, \
+        0.87008699110871146, 0.86704624551569265, 0.86397285612158681, 0.86086693863776731, \
+        0.85772861000027212, 0.85455798836540053, 0.8513551931052652, 0.84812034480329723, \
+        0.84485356524970712, 0.84155497743689844, 0.83822470555483808, 0.83486287498638001, \
+        0.83146961230254524, 0.8280450452577558, 0.82458930278502529, 0.82110251499110465, \
+        0.81758481315158371, 0.81403632970594841, 0.81045719825259477, 0.80684755354379933, \
+        0.80320753148064494, 0.79953726910790501, 0.79583690460888357, 0.79210657730021239, \
+        0.78834642762660634, 0.78455659715557524, 0.78073722857209449, 0.77688846567323244, \
+        0.77301045336273699, 0.7691033376455797, 0.76516726562245896, 0.76120238548426178, \
+        0.75720884650648457, 0.75318679904361252, 0.74913639452345937, 0.74505778544146606, \
+        0.74095112535495911, 0.7368165688773699, 0.73265427167241282, 0.7284643904482252, \
+        0.724247082951467, 0.72000250796138165, 0.71573082528381859, 0.71143219574521643, \
+        0.70710678118654757, 0.7027547444572253, 0.69837624940897292, 0.693971460889654, \
+        0.68954054473706694, 0.68508366777270036, 0.68060099779545313, 0.67609270357531603, \
+        0.67155895484701833, 0.66699992230363747, 0.66241577759017178, 0.65780669329707864, \
+        0.65317284295377676, 0.64851440102211255, 0.6438315428897915, 0.63912444486377573, \
+        0.63439328416364549, 0.6296382389149271, 0.62485948814238645, 0.62005721176328921, \
+        0.61523159058062682, 0.61038280627630948, 0.60551104140432555, 0.60061647938386897, \
+        0.59569930449243347, 0.59075970185887428, 0.58579785745643886, 0.58081395809576453, \
+        0.57580819141784534, 0.57078074588696737, 0.56573181078361323, 0.56066157619733603, \
+        0.55557023301960229, 0.55045797293660481, 0.54532498842204646, 0.54017147272989297, \
+        0.53499761988709726, 0.52980362468629483, 0.52458968267846884, 0.51935599016558953, \
+        0.51410274419322166, 0.50883014254310699, 0.50353838372571758, 0.49822766697278187, \
+        0.49289819222978409, 0.48755016014843605, 0.48218377207912283, 0.47679923006332225, \
+        0.47139673682599781, 0.46597649576796613, 0.46053871095824001, 0.45508358712634384, \
+        0.4496113296546066, 0.44412214457042926, 0.43861623853852771, 0.43309381885315201, \
+        0.4275550934302822, 0.42200027079979979, 0.41642956009763732, 0.41084317105790391, \
+        0.40524131400498986, 0.39962419984564679, 0.3939920400610481, 0.3883450466988263, \
+        0.38268343236508984, 0.37700741021641831, 0.3713171939518376, 0.36561299780477396, \
+        0.35989503653498828, 0.35416352542049051, 0.34841868024943451, 0.34266071731199438, \
+        0.33688985339222005, 0.33110630575987643, 0.32531029216226298, 0.31950203081601575, \
+        0.31368174039889157, 0.30784964004153498, 0.3020059493192282, 0.29615088824362396, \
+        0.29028467725446233, 0.28440753721127182, 0.27851968938505306, 0.27262135544994898, \
+        0.26671275747489842, 0.26079411791527557, 0.25486565960451463, 0.24892760574572026, \
+        0.24298017990326398, 0.23702360599436734, 0.23105810828067128, 0.22508391135979278, \
+        0.21910124015686977, 0.21311031991609136, 0.20711137619221856, 0.20110463484209196, \
+        0.19509032201612833, 0.18906866414980628, 0.18303988795514106, 0.17700422041214886, \
+        0.17096188876030136, 0.16491312048997009, 0.15885814333386139, 0.15279718525844341, \
+        0.14673047445536175, 0.14065823933284924, 0.13458070850712622, 0.12849811079379322, \
+        0.12241067519921628, 0.11631863091190488, 0.11022220729388318, 0.10412163387205473, \
+        0.09801714032956077, 0.091908956497132696, 0.08579731234443988, 0.079682437971430126, \
+        0.073564563599667454, 0.067443919563664106, 0.061320736302208648, 0.055195244349690031, \
+        0.049067674327418126, 0.042938256934940959, 0.036807222941358991, 0.030674803176636581, \
+        0.024541228522912264, 0.01840672990580482, 0.012271538285719944, 0.0061358846491545152, \
+        6.123233995736766e-17, -0.0061358846491543929, -0.012271538285719823, -0.018406729905804695, \
+        -0.024541228522912142, -0.030674803176636459, -0.036807222941358866, -0.042938256934940834, \
+        -0.049067674327418008, -0.055195244349689913, -0.06132073630220853, -0.067443919563663982, \
+        -0.073564563599667329, -0.079682437971430015, -0.085797312344439755, -0.091908956497132571, \
+        -0.098017140329560645, -0.1041216338720546, -0.11022220729388306, -0.11631863091190475, \
+        -0.12241067519921615, -0.12849811079379311, -0.13458070850712611, -0.14065823933284913, \
+        -0.14673047445536164, -0.1527971852584433, -0.15885814333386128, -0.16491312048996995, \
+        -0.17096188876030124, -0.17700422041214875, -0.18303988795514092, -0.18906866414980616, \
+        -0.19509032201612819, -0.20110463484209182, -0.20711137619221845, -0.21311031991609125, \
+        -0.21910124015686966, -0.22508391135979267, -0.23105810828067114, -0.23702360599436723, \
+        -0.24298017990326387, -0.24892760574572012, -0.25486565960451452, -0.26079411791527546, \
+        -0.26671275747489831, -0.27262135544994887, -0.27851968938505295, -0.28440753721127171, \
+        -0.29028467725446216, -0.29615088824362384, -0.30200594931922808, -0.30784964004153487, \
+        -0.31368174039889141, -0.31950203081601564, -0.32531029216226287, -0.33110630575987632, \
+        -0.33688985339221994, -0.34266071731199427, -0.3484186802494344, -0.3541635254204904, \
+        -0.35989503653498817, -0.36561299780477385, -0.37131719395183749, -0.3770074102164182, \
+        -0.38268343236508973, -0.38834504669882619, -0.39399204006104799, -0.39962419984564668, \
+        -0.40524131400498975, -0.4108431710579038, -0.41642956009763699, -0.42200027079979968, \
+        -0.42755509343028186, -0.4330938188531519, -0.43861623853852738, -0.44412214457042914, \
+        -0.44961132965460671, -0.45508358712634372, -0.46053871095824006, -0.46597649576796601, \
+        -0.4713967368259977, -0.47679923006332192, -0.48218377207912272, -0.48755016014843572, \
+        -0.49289819222978398, -0.49822766697278159, -0.50353838372571746, -0.5088301425431071, \
+        -0.51410274419322166, -0.51935599016558964, -0.52458968267846873, -0.52980362468629472, \
+        -0.53499761988709704, -0.54017147272989285, -0.54532498842204624, -0.5504579729366047, \
+        -0.55557023301960196, -0.56066157619733592, -0.56573181078361323, -0.57078074588696714, \
+        -0.57580819141784534, -0.58081395809576442, -0.58579785745643886, -0.59075970185887405, \
+        -0.59569930449243336, -0.60061647938386875, -0.60551104140432543, -0.61038280627630959, \
+        -0.61523159058062671, -0.62005721176328921, -0.62485948814238623, -0.6296382389149271, \
+        -0.63439328416364538, -0.63912444486377573, -0.64383154288979128, -0.64851440102211244, \
+        -0.65317284295377653, -0.65780669329707864, -0.66241577759017189, -0.66699992230363736, \
+        -0.67155895484701844, -0.67609270357531581, -0.68060099779545302, -0.68508366777270024, \
+        -0.68954054473706694, -0.69397146088965378, -0.6983762494089728, -0.70275474445722508, \
+        -0.70710678118654746, -0.71143219574521654, -0.71573082528381859, -0.72000250796138165, \
+        -0.72424708295146678, -0.7284643904482252, -0.7326542716724127, -0.7368165688773699, \
+        -0.74095112535495888, -0.74505778544146595, -0.74913639452345915, -0.75318679904361241, \
+        -0.75720884650648457, -0.76120238548426167, -0.76516726562245896, -0.76910333764557948, \
+        -0.77301045336273699, -0.77688846567323233, -0.78073722857209449, -0.78455659715557502, \
+        -0.78834642762660623, -0.79210657730021217, -0.79583690460888346, -0.79953726910790512, \
+        -0.80320753148064483, -0.80684755354379933, -0.81045719825259466, -0.81403632970594841, \
+        -0.8175848131515836, -0.82110251499110465, -0.82458930278502507, -0.82804504525775569, \
+        -0.83146961230254535, -0.83486287498638001, -0.83822470555483808, -0.84155497743689833, \
+        -0.84485356524970712, -0.84812034480329712, -0.8513551931052652, -0.85455798836540042, \
+        -0.85772861000027201, -0.86086693863776709, -0.8639728561215867, -0.86704624551569276, \
+        -0.87008699110871135, -0.87309497841829009, -0.87607009419540649, -0.87901222642863353, \
+        -0.88192126434835494, -0.88479709843093779, -0.88763962040285382, -0.89044872324475788, \
+        -0.89322430119551521, -0.89596624975618511, -0.89867446569395393, -0.90134884704602192, \
+        -0.90398929312344334, -0.90659570451491533, -0.90916798309052238, -0.91170603200542977, \
+        -0.91420975570353069, -0.91667905992104259, -0.91911385169005777, -0.92151403934204179, \
+        -0.92387953251128674, -0.92621024213831138, -0.92850608047321548, -0.93076696107898371, \
+        -0.93299279883473885, -0.93518350993894761, -0.93733901191257485, -0.93945922360218992, \
+        -0.9415440651830207, -0.94359345816196039, -0.94560732538052117, -0.94758559101774109, \
+        -0.94952818059303667, -0.95143502096900834, -0.95330604035419386, -0.95514116830577067, \
+        -0.95694033573220882, -0.95870347489587149, -0.96043051941556579, -0.96212140426904147, \
+        -0.96377606579543984, -0.96539444169768929, -0.96697647104485207, -0.96852209427441738, \
+        -0.97003125319454397, -0.97150389098625178, -0.97293995220556007, -0.97433938278557586, \
+        -0.97570213003852846, -0.97702814265775439, -0.97831737071962754, -0.97956976568544052, \
+        -0.98078528040323043, -0.98196386910955524, -0.98310548743121629, -0.98421009238692903, \
+        -0.98527764238894122, -0.98630809724459856, -0.98730141815785843, -0.98825756773074946, \
+        -0.98917650996478101, -0.99005821026229701, -0.99090263542778001, -0.99170975366909953, \
+        -0.99247953459870997, -0.9932119492347945, -0.99390697000235606, -0.99456457073425542, \
+        -0.99518472667219682, -0.99576741446765982, -0.996312612182778, -0.99682029929116567, \
+        -0.99729045667869021, -0.99772306664419164, -0.99811811290014918, -0.99847558057329477, \
+        -0.99879545620517241, -0.99907772775264536, -0.99932238458834954, -0.99952941750109314, \
+        -0.99969881869620425, -0.9998305817958234, -0.9999247018391445, -0.99998117528260111 \
+    }
+
+#define FFT_TABLE_1024_SIN \
+    { \
+        0, 0.0061358846491544753, 0.012271538285719925, 0.01840672990580482, \
+        0.024541228522912288, 0.030674803176636626, 0.036807222941358832, 0.04293825693494082, \
+        0.049067674327418015, 0.055195244349689934, 0.061320736302208578, 0.067443919563664051, \
+        0.073564563599667426, 0.079682437971430126, 0.085797312344439894, 0.091908956497132724, \
+        0.098017140329560604, 0.10412163387205459, 0.11022220729388306, 0.11631863091190475, \
+        0.1224106751992162, 0.12849811079379317, 0.13458070850712617, 0.14065823933284921, \
+        0.14673047445536175, 0.15279718525844344, 0.15885814333386145, 0.16491312048996992, \
+        0.17096188876030122, 0.17700422041214875, 0.18303988795514095, 0.18906866414980619, \
+        0.19509032201612825, 0.2011046348420919, 0.20711137619221856, 0.21311031991609136, \
+        0.2191012401568698, 0.22508391135979283, 0.23105810828067111, 0.2370236059943672, \
+        0.24298017990326387, 0.24892760574572015, 0.25486565960451457, 0.26079411791527551, \
+        0.26671275747489837, 0.27262135544994898, 0.27851968938505306, 0.28440753721127188, \
+        0.29028467725446233, 0.29615088824362379, 0.30200594931922808, 0.30784964004153487, \
+        0.31368174039889152, 0.31950203081601569, 0.32531029216226293, 0.33110630575987643, \
+        0.33688985339222005, 0.34266071731199438, 0.34841868024943456, 0.35416352542049034, \
+        0.35989503653498811, 0.36561299780477385, 0.37131719395183754, 0.37700741021641826, \
+        0.38268343236508978, 0.38834504669882625, 0.3939920400610481, 0.39962419984564679, \
+        0.40524131400498986, 0.41084317105790391, 0.41642956009763715, 0.42200027079979968, \
+        0.42755509343028208, 0.43309381885315196, 0.43861623853852766, 0.4441221445704292, \
+        0.44961132965460654, 0.45508358712634384, 0.46053871095824001, 0.46597649576796618, \
+        0.47139673682599764, 0.47679923006332209, 0.48218377207912272, 0.487550160148436, \
+        0.49289819222978404, 0.49822766697278187, 0.50353838372571758, 0.50883014254310699, \
+        0.51410274419322166, 0.51935599016558964, 0.52458968267846895, 0.52980362468629461, \
+        0.53499761988709715, 0.54017147272989285, 0.54532498842204646, 0.55045797293660481, \
+        0.55557023301960218, 0.56066157619733603, 0.56573181078361312, 0.57078074588696726, \
+        0.57580819141784534, 0.58081395809576453, 0.58579785745643886, 0.59075970185887416, \
+        0.59569930449243336, 0.60061647938386897, 0.60551104140432555, 0.61038280627630948, \
+        0.61523159058062682, 0.6200572117632891, 0.62485948814238634, 0.62963823891492698, \
+        0.63439328416364549, 0.63912444486377573, 0.64383154288979139, 0.64851440102211244, \
+        0.65317284295377676, 0.65780669329707864, 0.66241577759017178, 0.66699992230363747, \
+        0.67155895484701833, 0.67609270357531592, 0.68060099779545302, 0.68508366777270036, \
+        0.68954054473706683, 0.693971460889654, 0.69837624940897292, 0.7027547444572253, \
+        0.70710678118654746, 0.71143219574521643, 0.71573082528381859, 0.72000250796138165, \
+        0.72424708295146689, 0.7284643904482252, 0.73265427167241282, 0.73681656887736979, \
+        0.74095112535495911, 0.74505778544146595, 0.74913639452345926, 0.75318679904361241, \
+        0.75720884650648446, 0.76120238548426178, 0.76516726562245896, 0.76910333764557959, \
+        0.77301045336273699, 0.77688846567323244, 0.78073722857209438, 0.78455659715557524, \
+        0.78834642762660623, 0.79210657730021239, 0.79583690460888346, 0.79953726910790501, \
+        0.80320753148064483, 0.80684755354379922, 0.81045719825259477, 0.8140363297059483, \
+        0.81758481315158371, 0.82110251499110465, 0.82458930278502529, 0.8280450452577558, \
+        0.83146961230254524, 0.83486287498638001, 0.83822470555483797, 0.84155497743689833, \
+        0.84485356524970701, 0.84812034480329712, 0.8513551931052652, 0.85455798836540053, \
+        0.85772861000027212, 0.86086693863776731, 0.8639728561215867, 0.86704624551569265, \
+        0.87008699110871135, 0.87309497841829009, 0.8760700941954066, 0.87901222642863341, \
+        0.88192126434835494, 0.88479709843093779, 0.88763962040285393, 0.89044872324475788, \
+        0.89322430119551532, 0.89596624975618511, 0.89867446569395382, 0.90134884704602203, \
+        0.90398929312344334, 0.90659570451491533, 0.90916798309052227, 0.91170603200542988, \
+        0.91420975570353069, 0.9166790599210427, 0.91911385169005777, 0.9215140393420419, \
+        0.92387953251128674, 0.92621024213831127, 0.92850608047321548, 0.93076696107898371, \
+        0.93299279883473885, 0.9351835099389475, 0.93733901191257496, 0.93945922360218992, \
+        0.94154406518302081, 0.94359345816196039, 0.94560732538052128, 0.94758559101774109, \
+        0.94952818059303667, 0.95143502096900834, 0.95330604035419375, 0.95514116830577067, \
+        0.95694033573220894, 0.9587034748958716, 0.96043051941556579, 0.96212140426904158, \
+        0.96377606579543984, 0.9653944416976894, 0.96697647104485207, 0.96852209427441727, \
+        0.97003125319454397, 0.97150389098625178, 0.97293995220556007, 0.97433938278557586, \
+        0.97570213003852857, 0.97702814265775439, 0.97831737071962765, 0.97956976568544052, \
+        0.98078528040323043, 0.98196386910955524, 0.98310548743121629, 0.98421009238692903, \
+        0.98527764238894122, 0.98630809724459867, 0.98730141815785843, 0.98825756773074946, \
+        0.98917650996478101, 0.99005821026229712, 0.99090263542778001, 0.99170975366909953, \
+        0.99247953459870997, 0.9932119492347945, 0.99390697000235606, 0.99456457073425542, \
+        0.99518472667219682, 0.99576741446765982, 0.996312612182778, 0.99682029929116567, \
+        0.99729045667869021, 0.99772306664419164, 0.99811811290014918, 0.99847558057329477, \
+        0.99879545620517241, 0.99907772775264536, 0.99932238458834954, 0.99952941750109314, \
+        0.99969881869620425, 0.9998305817958234, 0.9999247018391445, 0.99998117528260111, \
+        1, 0.99998117528260111, 0.9999247018391445, 0.9998305817958234, \
+        0.99969881869620425, 0.99952941750109314, 0.99932238458834954, 0.99907772775264536, \
+        0.99879545620517241, 0.99847558057329477, 0.99811811290014918, 0.99772306664419164, \
+        0.99729045667869021, 0.99682029929116578, 0.996312612182778, 0.99576741446765982, \
+        0.99518472667219693, 0.99456457073425542, 0.99390697000235606, 0.9932119492347945, \
+        0.99247953459870997, 0.99170975366909953, 0.99090263542778001, 0.99005821026229712, \
+        0.98917650996478101, 0.98825756773074946, 0.98730141815785843, 0.98630809724459867, \
+        0.98527764238894122, 0.98421009238692903, 0.98310548743121629, 0.98196386910955524, \
+        0.98078528040323043, 0.97956976568544052, 0.97831737071962765, 0.97702814265775439, \
+        0.97570213003852857, 0.97433938278557586, 0.97293995220556018, 0.97150389098625178, \
+        0.97003125319454397, 0.96852209427441738, 0.96697647104485207, 0.9653944416976894, \
+        0.96377606579543984, 0.96212140426904158, 0.9604305194155659, 0.9587034748958716, \
+        0.95694033573220894, 0.95514116830577067, 0.95330604035419386, 0.95143502096900834, \
+        0.94952818059303667, 0.9475855910177412, 0.94560732538052139, 0.94359345816196039, \
+        0.94154406518302081, 0.93945922360218992, 0.93733901191257496, 0.93518350993894761, \
+        0.93299279883473885, 0.93076696107898371, 0.92850608047321559, 0.92621024213831138, \
+        0.92387953251128674, 0.92151403934204201, 0.91911385169005777, 0.9166790599210427, \
+        0.91420975570353069, 0.91170603200542988, 0.90916798309052249, 0.90659570451491533, \
+        0.90398929312344345, 0.90134884704602203, 0.89867446569395393, 0.89596624975618522, \
+        0.89322430119551521, 0.89044872324475799, 0.88763962040285393, 0.8847970984309379, \
+        0.88192126434835505, 0.87901222642863353, 0.8760700941954066, 0.8730949784182902, \
+        0.87008699110871146, 0.86704624551569276, 0.86397285612158681, 0.8608669386377672, \
+        0.85772861000027212, 0.85455798836540053, 0.8513551931052652, 0.84812034480329723, \
+        0.84485356524970723, 0.84155497743689844, 0.83822470555483819, 0.83486287498638012, \
+        0.83146961230254546, 0.8280450452577558, 0.82458930278502518, 0.82110251499110476, \
+        0.81758481315158371, 0.81403632970594852, 0.81045719825259477, 0.80684755354379945, \
+        0.80320753148064494, 0.79953726910790524, 0.79583690460888357, 0.79210657730021228, \
+        0.78834642762660634, 0.78455659715557513, 0.7807372285720946, 0.77688846567323244, \
+        0.7730104533627371, 0.76910333764557959, 0.76516726562245907, 0.76120238548426189, \
+        0.75720884650648468, 0.75318679904361252, 0.74913639452345926, 0.74505778544146606, \
+        0.74095112535495899, 0.73681656887737002, 0.73265427167241282, 0.72846439044822531, \
+        0.72424708295146689, 0.72000250796138177, 0.71573082528381871, 0.71143219574521666, \
+        0.70710678118654757, 0.70275474445722519, 0.69837624940897292, 0.693971460889654, \
+        0.68954054473706705, 0.68508366777270036, 0.68060099779545324, 0.67609270357531592, \
+        0.67155895484701855, 0.66699992230363758, 0.66241577759017201, 0.65780669329707875, \
+        0.65317284295377664, 0.64851440102211255, 0.64383154288979139, 0.63912444486377584, \
+        0.63439328416364549, 0.62963823891492721, 0.62485948814238634, 0.62005721176328943, \
+        0.61523159058062693, 0.6103828062763097, 0.60551104140432566, 0.60061647938386886, \
+        0.59569930449243347, 0.59075970185887416, 0.58579785745643898, 0.58081395809576453, \
+        0.57580819141784545, 0.57078074588696726, 0.56573181078361345, 0.56066157619733614, \
+        0.55557023301960218, 0.55045797293660492, 0.54532498842204635, 0.54017147272989297, \
+        0.53499761988709715, 0.52980362468629483, 0.52458968267846895, 0.51935599016558975, \
+        0.51410274419322177, 0.50883014254310732, 0.50353838372571769, 0.49822766697278176, \
+        0.49289819222978415, 0.48755016014843588, 0.48218377207912289, 0.47679923006332209, \
+        0.47139673682599786, 0.46597649576796618, 0.46053871095824023, 0.45508358712634389, \
+        0.44961132965460687, 0.44412214457042931, 0.43861623853852755, 0.43309381885315207, \
+        0.42755509343028203, 0.42200027079979985, 0.41642956009763715, 0.41084317105790413, \
+        0.40524131400498992, 0.39962419984564707, 0.39399204006104815, 0.38834504669882658, \
+        0.38268343236508989, 0.37700741021641815, 0.37131719395183771, 0.3656129978047738, \
+        0.35989503653498833, 0.3541635254204904, 0.34841868024943479, 0.34266071731199443, \
+        0.33688985339222033, 0.33110630575987648, 0.32531029216226326, 0.3195020308160158, \
+        0.31368174039889141, 0.30784964004153503, 0.30200594931922803, 0.29615088824362401, \
+        0.29028467725446239, 0.2844075372112721, 0.27851968938505317, 0.27262135544994925, \
+        0.26671275747489848, 0.26079411791527585, 0.25486565960451468, 0.24892760574572009, \
+        0.24298017990326407, 0.23702360599436717, 0.23105810828067133, 0.22508391135979283, \
+        0.21910124015687005, 0.21311031991609142, 0.20711137619221884, 0.20110463484209201, \
+        0.19509032201612861, 0.18906866414980636, 0.1830398879551409, 0.17700422041214894, \
+        0.17096188876030122, 0.16491312048997014, 0.15885814333386147, 0.15279718525844369, \
+        0.1467304744553618, 0.14065823933284954, 0.13458070850712628, 0.12849811079379309, \
+        0.12241067519921635, 0.11631863091190471, 0.11022220729388324, 0.10412163387205457, \
+        0.098017140329560826, 0.091908956497132752, 0.085797312344440158, 0.079682437971430195, \
+        0.073564563599667732, 0.067443919563664176, 0.061320736302208488, 0.055195244349690094, \
+        0.049067674327417966, 0.042938256934941021, 0.036807222941358832, 0.030674803176636865, \
+        0.024541228522912326, 0.018406729905805101, 0.012271538285720007, 0.0061358846491547988 \
+    }
+
+#define FFT_TABLE_1024_REV \
+    { \
+        0, 512, 256, 768, 128, 640, 384, 896, 64, 576, 320, 832, 192, 704, 448, 960, \
+        32, 544, 288, 800, 160, 672, 416, 928, 96, 608, 352, 864, 224, 736, 480, 992, \
+        16, 528, 272, 784, 144, 656, 400, 912, 80, 592, 336, 848, 208, 720, 464, 976, \
+        48, 560, 304, 816, 176, 688, 432, 944, 112, 624, 368, 880, 240, 752, 496, 1008, \
+        8, 520, 264, 776, 136, 648, 392, 904, 72, 584, 328, 840, 200, 712, 456, 968, \
+        40, 552, 296, 808, 168, 680, 424, 936, 104, 616, 360, 872, 232, 744, 488, 1000, \
+        24, 536, 280, 792, 152, 664, 408, 920, 88, 600, 344, 856, 216, 728, 472, 984, \
+        56, 568, 312, 824, 184, 696, 440, 952, 120, 632, 376, 888, 248, 760, 504, 1016, \
+        4, 516, 260, 772, 132, 644, 388, 900, 68, 580, 324, 836, 196, 708, 452, 964, \
+        36, 548, 292, 804, 164, 676, 420, 932, 100, 612, 356, 868, 228, 740, 484, 996, \
+        20, 532, 276, 788, 148, 660, 404, 916, 84, 596, 340, 852, 212, 724, 468, 980, \
+        52, 564, 308, 820, 180, 692, 436, 948, 116, 628, 372, 884, 244, 756, 500, 1012, \
+        12, 524, 268, 780, 140, 652, 396, 908, 76, 588, 332, 844, 204, 716, 460, 972, \
+        44, 556, 300, 812, 172, 684, 428, 940, 108, 620, 364, 876, 236, 748, 492, 1004, \
+        28, 540, 284, 796, 156, 668, 412, 924, 92, 604, 348, 860, 220, 732, 476, 988, \
+        60, 572, 316, 828, 188, 700, 444, 956, 124, 636, 380, 892, 252, 764, 508, 1020, \
+        2, 514, 258, 770, 130, 642, 386, 898, 66, 578, 322, 834, 194, 706, 450, 962, \
+        34, 546, 290, 802, 162, 674, 418, 930, 98, 610, 354, 866, 226, 738, 482, 994, \
+        18, 530, 274, 786, 146, 658, 402, 914, 82, 594, 338, 850, 210, 722, 466, 978, \
+        50, 562, 306, 818, 178, 690, 434, 946, 114, 626, 370, 882, 242, 754, 498, 1010, \
+        10, 522, 266, 778, 138, 650, 394, 906, 74, 586, 330, 842, 202, 714, 458, 970, \
+        42, 554, 298, 810, 170, 682, 426, 938, 106, 618, 362, 874, 234, 746, 490, 1002, \
+        26, 538, 282, 794, 154, 666, 410, 922, 90, 602, 346, 858, 218, 730, 474, 986, \
+        58, 570, 314, 826, 186, 698, 442, 954, 122, 634, 378, 890, 250, 762, 506, 1018, \
+        6, 518, 262, 774, 134, 646, 390, 902, 70, 582, 326, 838, 198, 710, 454, 966, \
+        38, 550, 294, 806, 166, 678, 422, 934, 102, 614, 358, 870, 230, 742, 486, 998, \
+        22, 534, 278, 790, 150, 662, 406, 918, 86, 598, 342, 854, 214, 726, 470, 982, \
+        54, 566, 310, 822, 182, 694, 438, 950, 118, 630, 374, 886, 246, 758, 502, 1014, \
+        14, 526, 270, 782, 142, 654, 398, 910, 78, 590, 334, 846, 206, 718, 462, 974, \
+        46, 558, 302, 814, 174, 686, 430, 942, 110, 622, 366, 878, 238, 750, 494, 1006, \
+        30, 542, 286, 798, 158, 670, 414, 926, 94, 606, 350, 862, 222, 734, 478, 990, \
+        62, 574, 318, 830, 190, 702, 446, 958, 126, 638, 382, 894, 254, 766, 510, 1022, \
+        1, 513, 257, 769, 129, 641, 385, 897, 65, 577, 321, 833, 193, 705, 449, 961, \
+        33, 545, 289, 801, 161, 673, 417, 929, 97, 609, 353, 865, 225, 737, 481, 993, \
+        17, 529, 273, 785, 145, 657, 401, 913, 81, 593, 337, 849, 209, 721, 465, 977, \
+        49, 561, 305, 817, 177, 689, 433, 945, 113, 625, 369, 881, 241, 753, 497, 1009, \
+        9, 521, 265, 777, 137, 649, 393, 905, 73, 585, 329, 841, 201, 713, 457, 969, \
+        41, 553, 297, 809, 169, 681, 425, 937, 105, 617, 361, 873, 233, 745, 489, 1001, \
+        25, 537, 281, 793, 153, 665, 409, 921, 89, 601, 345, 857, 217, 729, 473, 985, \
+        57, 569, 313, 825, 185, 697, 441, 953, 121, 633, 377, 889, 249, 761, 505, 1017, \
+        5, 517, 261, 773, 133, 645, 389, 901, 69, 581, 325, 837, 197, 709, 453, 965, \
+        37, 549, 293, 805, 165, 677, 421, 933, 101, 613, 357, 869, 229, 741, 485, 997, \
+        21, 533, 277, 789, 149, 661, 405, 917, 85, 597, 341, 853, 213, 725, 469, 981, \
+        53, 565, 309, 821, 181, 693, 437, 949, 117, 629, 373, 885, 245, 757, 501, 1013, \
+        13, 525, 269, 781, 141, 653, 397, 909, 77, 589, 333, 845, 205, 717, 461, 973, \
+        45, 557, 301, 813, 173, 685, 429, 941, 109, 621, 365, 877, 237, 749, 493, 1005, \
+        29, 541, 285, 797, 157, 669, 413, 925, 93, 605, 349, 861, 221, 733, 477, 989, \
+        61, 573, 317, 829, 189, 701, 445, 957, 125, 637, 381, 893, 253, 765, 509, 1021, \
+        3, 515, 259, 771, 131, 643, 387, 899, 67, 579, 323, 835, 195, 707, 451, 963, \
+        35, 547, 291, 803, 163, 675, 419, 931, 99, 611, 355, 867, 227, 739, 483, 995, \
+        19, 531, 275, 787, 147, 659, 403, 915, 83, 595, 339, 851, 211, 723, 467, 979, \
+        51, 563, 307, 819, 179, 691, 435, 947, 115, 627, 371, 883, 243, 755, 499, 1011, \
+        11, 523, 267, 779, 139, 651, 395, 907, 75, 587, 331, 843, 203, 715, 459, 971, \
+        43, 555, 299, 811, 171, 683, 427, 939, 107, 619, 363, 875, 235, 747, 491, 1003, \
+        27, 539, 283, 795, 155, 667, 411, 923, 91, 603, 347, 859, 219, 731, 475, 987, \
+        59, 571, 315, 827, 187, 699, 443, 955, 123, 635, 379, 891, 251, 763, 507, 1019, \
+        7, 519, 263, 775, 135, 647, 391, 903, 71, 583, 327, 839, 199, 711, 455, 967, \
+        39, 551, 295, 807, 167, 679, 423, 935, 103, 615, 359, 871, 231, 743, 487, 999, \
+        23, 535, 279, 791, 151, 663, 407, 919, 87, 599, 343, 855, 215, 727, 471, 983, \
+        55, 567, 311, 823, 183, 695, 439, 951, 119, 631, 375, 887, 247, 759, 503, 1015, \
+        15, 527, 271, 783, 143, 655, 399, 911, 79, 591, 335, 847, 207, 719, 463, 975, \
+        47, 559, 303, 815, 175, 687, 431, 943, 111, 623, 367, 879, 239, 751, 495, 1007, \
+        31, 543, 287, 799, 159, 671, 415, 927, 95, 607, 351, 863, 223, 735, 479, 991, \
+        63, 575, 319, 831, 191, 703, 447, 959, 127, 639, 383, 895, 255, 767, 511, 1023 \
+    }
+
+#define FFT_TABLE_1024_HAMMING \
+    { \
+        0.080000000000000016, 0.080008676307589288, 0.080034704903059861, 0.080078084804533267, \
+        0.080138814375586065, 0.080216891325311956, 0.080312312708408273, 0.080425074925286777, \
+        0.080555173722209883, 0.080702604191450644, 0.080867360771478214, 0.081049437247167455, \
+        0.081248826750033698, 0.081465521758491311, 0.081699514098138026, 0.081950794942062921, \
+        0.082219354811179424, 0.082505183574583141, 0.082808270449933663, 0.083128604003861739, \
+        0.083466172152400153, 0.083820962161439805, 0.084192960647210158, 0.084582153576783725, \
+        0.084988526268605979, 0.085412063393048687, 0.085852748972988613, 0.086310566384409926, \
+        0.08678549835703131, 0.08727752697495772, 0.087786633677355952, 0.088312799259154917, \
+        0.088856003871770173, 0.089416227023852546, 0.089993447582061237, 0.090587643771861015, \
+        0.091198793178343451, 0.091826872747072907, 0.092471858784955729, 0.0931337269611342, \
+        0.093812452307904581, 0.094508009221658695, 0.095220371463849929, 0.095949512161982886, \
+        0.096695403810627245, 0.09745801827245526, 0.098237326779303413, 0.099033299933257157, \
+        0.099845907707760417, 0.10067511944874796, 0.10152090387580182, 0.10238322908333147, \
+        0.10326206254177706, 0.10415737109883688, 0.10506912098071769, 0.10599727779340912, \
+        0.10694180652398061, 0.10790267154190269, 0.10887983660039074, 0.1098732648377726, \
+        0.11088291877887885, 0.11190876033645675, 0.11295075081260664, 0.11400885090024215, \
+        0.11508302068457282, 0.11617321964460964, 0.11727940665469394, 0.11840153998604847, \
+        0.11953957730835185, 0.12069347569133504, 0.12186319160640119, 0.12304868092826726, \
+        0.12424989893662902, 0.12546680031784763, 0.12669933916665921, 0.12794746898790654, \
+        0.12921114269829287, 0.13049031262815824, 0.13178493052327761, 0.133094947546681, \
+        0.13442031428049606, 0.13576098072781217, 0.13711689631456647, 0.13848800989145155, \
+        0.13987426973584499, 0.14127562355376078, 0.14269201848182167, 0.14412340108925348, \
+        0.14556971737990054, 0.14703091279426289, 0.14850693221155425, 0.14999771995178113, \
+        0.15150321977784359, 0.15302337489765666, 0.15455812796629248, 0.15610742108814363, \
+        0.15767119581910716, 0.15924939316878944, 0.16084195360273096, 0.16244881704465292, \
+        0.16406992287872263, 0.16570520995184079, 0.16735461657594808, 0.16901808053035222, \
+        0.17069553906407542, 0.17238692889822094, 0.17409218622836087, 0.17581124672694237, \
+        0.1775440455457149, 0.17929051731817613, 0.18105059616203778, 0.18282421568171103, \
+        0.18461130897081102, 0.1864118086146811, 0.18822564669293534, 0.19005275478202133, \
+        0.19189306395780087, 0.19374650479815009, 0.19561300738557857, 0.1974925013098664, \
+        0.19938491567072048, 0.20129017908044927, 0.20320821966665531, 0.20513896507494711, \
+        0.20708234247166774, 0.2090382785466432, 0.21100669951594725, 0.21298753112468521, \
+        0.2149806986497948, 0.21698612690286506, 0.21900374023297259, 0.22103346252953543, \
+        0.2230752172251842, 0.22512892729865036, 0.22719451527767182, 0.22927190324191515, \
+        0.23136101282591542, 0.23346176522203199, 0.23557408118342155, 0.23769788102702755, \
+        0.23983308463658609, 0.24197961146564806, 0.2441373805406179, 0.24630631046380758, \
+        0.24848631941650789, 0.25067732516207425, 0.25287924504902942, 0.25509199601418125, \
+        0.2573154945857557, 0.25954965688654613, 0.26179439863707721, 0.26404963515878421, \
+        0.26631528137720745, 0.26859125182520133, 0.27087746064615853, 0.27317382159724884, \
+        0.27548024805267257, 0.27779665300692807, 0.28012294907809432, 0.28245904851112646, \
+        0.28480486318116693, 0.28716030459686981, 0.28952528390373816, 0.29189971188747676, \
+        0.29428349897735745, 0.29667655524959724, 0.29907879043075164, 0.30149011390111885, \
+        0.30391043469815937, 0.30633966151992686, 0.30877770272851179, 0.31122446635349954, \
+        0.31367986009543852, 0.31614379132932291, 0.31861616710808649, 0.32109689416610843, \
+        0.32358587892273244, 0.3260830274857961, 0.32858824565517308, 0.33110143892632693, \
+        0.33362251249387564, 0.3361513712551682, 0.33868791981387231, 0.34123206248357252, \
+        0.34378370329138042, 0.34634274598155468, 0.34890909401913217, 0.35148265059356981, \
+        0.35406331862239571, 0.35665100075487288, 0.35924559937567002, 0.36184701660854512, \
+        0.364455154320037, 0.36706991412316714, 0.36969119738115175, 0.37231890521112176, \
+        0.37495293848785383, 0.37759319784750944, 0.38023958369138267, 0.38289199618965797, \
+        0.38555033528517579, 0.38821450069720709, 0.3908843919252365, 0.39355990825275278, \
+        0.39624094875104915, 0.39892741228302964, 0.40161919750702502, 0.40431620288061565, \
+        0.40701832666446147, 0.4097254669261402, 0.41243752154399277, 0.41515438821097539, \
+        0.41787596443851927, 0.42060214756039588, 0.42333283473659117, 0.42606792295718365, \
+        0.42880730904623132, 0.43155088966566346, 0.43429856131917827, 0.43705022035614816, \
+        0.43980576297552831, 0.44256508522977417, 0.44532808302876137, 0.4480946521437123, \
+        0.45086468821112891, 0.45363808673672884, 0.45641474309938723, 0.4591945525550839, \
+        0.46197741024085409, 0.46476321117874453, 0.46755185027977353, 0.47034322234789472, \
+        0.47313722208396641, 0.47593374408972261, 0.47873268287175003, 0.48153393284546692, \
+        0.48433738833910622, 0.48714294359770205, 0.4899504927870787, 0.49275992999784346, \
+        0.49557114924938173, 0.49838404449385448, 0.50119850962019941, 0.50401443845813321, \
+        0.50683172478215699, 0.50965026231556354, 0.51246994473444551, 0.51529066567170778, \
+        0.51811231872107855, 0.52093479744112392, 0.5237579953592636, 0.52658180597578652, \
+        0.52940612276786869, 0.53223083919359171, 0.53505584869596201, 0.53788104470693021, \
+        0.54070632065141089, 0.54353156995130358, 0.54635668602951293, 0.54918156231396908, \
+        0.55200609224164798, 0.55483016926259088, 0.5576536868439248, 0.56047653847387979, \
+        0.5632986176658078, 0.56611981796220012, 0.56894003293870166, 0.57175915620812756, \
+        0.57457708142447517, 0.57739370228693576, 0.5802089125439055, 0.58302260599699218, \
+        0.58583467650502286, 0.58864501798804647, 0.59145352443133636, 0.59426008988938928, \
+        0.5970646084899216, 0.59986697443786396, 0.60266708201935137, 0.60546482560571113, \
+        0.60826009965744832, 0.61105279872822582, 0.61384281746884317, 0.61663005063121012, \
+        0.61941439307231683, 0.62219573975820042, 0.62497398576790708, 0.62774902629745033, \
+        0.63052075666376406, 0.6332890723086515, 0.63605386880272996, 0.63881504184936988, \
+        0.64157248728862926, 0.64432610110118294, 0.64707577941224648, 0.64982141849549468, \
+        0.65256291477697426, 0.65530016483901143, 0.658033065424113, 0.6607615134388608, \
+        0.66348540595780214, 0.66620464022733084, 0.6689191136695648, 0.67162872388621475, \
+        0.6743333686624472, 0.6770329459707406, 0.67972735397473349, 0.68241649103306679, \
+        0.68510025570321753, 0.6877785467453259, 0.6904512631260139, 0.69311830402219743, \
+        0.69577956882488845, 0.69843495714299175, 0.70108436880709013, 0.70372770387322536, \
+        0.7063648626266662, 0.70899574558567147, 0.71162025350524205, 0.71423828738086503, \
+        0.71684974845224825, 0.71945453820704608, 0.72205255838457527, 0.72464371097952229, \
+        0.72722789824563927, 0.72980502269943237, 0.73237498712383897, 0.73493769457189473, \
+        0.73749304837038998, 0.74004095212351839, 0.74258130971651171, 0.74511402531926629, \
+        0.74763900338995781, 0.75015614867864489, 0.75266536623086411, 0.75516656139120919, \
+        0.75765963980690409, 0.76014450743136108, 0.76262107052772887, 0.76508923567242793, \
+        0.76754890975867629, 0.76999999999999991, 0.77244241393373458, 0.7748760594245121, \
+        0.77730084466773797, 0.7797166781930529, 0.78212346886778383, 0.78452112590038259, \
+        0.78690955884384917, 0.78928867759914512, 0.79165839241859159, 0.79401861390925554, \
+        0.79636925303632078, 0.79871022112644785, 0.80104142987111882, 0.80336279132996735, \
+        0.80567421793409799, 0.80797562248938815, 0.81026691817977781, 0.81254801857054404, \
+        0.81481883761156293, 0.81707928964055387, 0.81932928938631189, 0.82156875197192503, \
+        0.82379759291797428, 0.82601572814572277, 0.82822307398028505, 0.83041954715378608, \
+        0.83260506480849994, 0.83477954449997704, 0.83694290420015371, 0.83909506230044673, \
+        0.84123593761483106, 0.84336544938290403, 0.84548351727293003, 0.84759006138487214, \
+        0.8496850022534056, 0.85176826085091595, 0.85383975859048, 0.85589941732882946, \
+        0.85794715936930099, 0.85998290746476447, 0.86200658482053916, 0.86401811509728921, \
+        0.86601742241390434, 0.86800443135036143, 0.86997906695057048, 0.87194125472520212, \
+        0.87389092065449647, 0.8758279911910567, 0.87775239326262278, 0.87966405427482841, \
+        0.88156290211393851, 0.88344886514957155, 0.88532187223739922, 0.88718185272183203, \
+        0.88902873643868385, 0.89086245371781914, 0.89268293538578081, 0.89449011276839918, \
+        0.89628391769338434, 0.89806428249289527, 0.89983114000609499, 0.90158442358168223, \
+        0.90332406708040658, 0.90505000487756315, 0.90676217186546881, 0.908460503455917, \
+        0.91014493558261533, 0.91181540470360178, 0.9134718478036421, 0.91511420239660668, \
+        0.91674240652782724, 0.91835639877643516, 0.9199561182576772, 0.92154150462521311, \
+        0.9231124980733918, 0.92466903933950717, 0.92621106970603395, 0.92773853100284276, \
+        0.92925136560939436, 0.93074951645691306, 0.93223292703053984, 0.93370154137146444, \
+        0.93515530407903569, 0.93659416031285136, 0.93801805579482833, 0.93942693681124823, \
+        0.94082075021478451, 0.94219944342650774, 0.94356296443786858, 0.94491126181265939, \
+        0.94624428468895516, 0.94756198278103243, 0.94886430638126473, 0.95015120636199979, \
+        0.9514226341774108, 0.95267854186532941, 0.95391888204905362, 0.95514360793913577, \
+        0.95635267333514784, 0.95754603262742299, 0.95872364079877759, 0.95988545342620846, \
+        0.96103142668256913, 0.96216151733822253, 0.96327568276267295, 0.96437388092617227, \
+        0.96545607040130754, 0.96652221036456254, 0.96757226059785761, 0.96860618149006761, \
+        0.96962393403851554, 0.97062547985044445, 0.97161078114446475, 0.97257980075198081, \
+        0.97353250211859144, 0.97446884930547029, 0.97538880699072095, 0.97629234047070912, \
+        0.97717941566137245, 0.97804999909950541, 0.97890405794402247, 0.9797415599771967, \
+        0.98056247360587467, 0.98136676786266874, 0.98215441240712553, 0.98292537752686915, \
+        0.98367963413872372, 0.98441715378980932, 0.98513790865861584, 0.98584187155605207, \
+        0.98652901592647191, 0.98719931584867582, 0.98785274603688822, 0.98848928184171259, \
+        0.98910889925105971, 0.98971157489105499, 0.99029728602691902, 0.99086601056382573, \
+        0.99141772704773601, 0.99195241466620687, 0.99247005324917614, 0.99297062326972418, \
+        0.99345410584480986, 0.99392048273598266, 0.99436973635007186, 0.99480184973984875, \
+        0.99521680660466716, 0.99561459129107721, 0.99599518879341697, 0.99635858475437766, \
+        0.99670476546554587, 0.99703371786791983, 0.99734542955240302, 0.99763988876027176, \
+        0.99791708438361892, 0.99817700596577275, 0.99841964370169145, 0.99864498843833327, \
+        0.99885303167500128, 0.99904376556366481, 0.99921718290925465, 0.99937327716993507, \
+        0.99951204245735026, 0.99963347353684662, 0.99973756582767037, 0.9998243154031401, \
+        0.99989371899079482, 0.99994577397251772, 0.99998047838463466, 0.99999783091798866, \
+        0.99999783091798866, 0.99998047838463466, 0.99994577397251772, 0.99989371899079482, \
+        0.9998243154031401, 0.99973756582767037, 0.99963347353684662, 0.99951204245735026, \
+        0.99937327716993507, 0.99921718290925465, 0.99904376556366481, 0.99885303167500128, \
+        0.99864498843833327, 0.99841964370169145, 0.99817700596577275, 0.99791708438361892, \
+        0.99763988876027176, 0.99734542955240302, 0.99703371786791972, 0.99670476546554587, \
+        0.99635858475437766, 0.99599518879341697, 0.99561459129107721, 0.99521680660466716, \
+        0.99480184973984875, 0.99436973635007186, 0.99392048273598266, 0.99345410584480986, \
+        0.99297062326972418, 0.99247005324917625, 0.99195241466620687, 0.99141772704773601, \
+        0.99086601056382573, 0.99029728602691902, 0.98971157489105499, 0.98910889925105983, \
+        0.98848928184171259, 0.98785274603688822, 0.98719931584867571, 0.98652901592647191, \
+        0.98584187155605207, 0.98513790865861584, 0.98441715378980943, 0.98367963413872372, \
+        0.98292537752686915, 0.98215441240712553, 0.98136676786266896, 0.98056247360587467, \
+        0.97974155997719681, 0.97890405794402258, 0.97804999909950552, 0.97717941566137245, \
+        0.97629234047070934, 0.97538880699072106, 0.97446884930547029, 0.97353250211859155, \
+        0.97257980075198081, 0.97161078114446486, 0.97062547985044434, 0.96962393403851554, \
+        0.9686061814900675, 0.96757226059785761, 0.96652221036456254, 0.96545607040130776, \
+        0.96437388092617238, 0.96327568276267295, 0.96216151733822275, 0.96103142668256902, \
+        0.95988545342620846, 0.95872364079877759, 0.95754603262742299, 0.95635267333514773, \
+        0.955143607939136, 0.95391888204905362, 0.95267854186532941, 0.95142263417741102, \
+        0.95015120636199979, 0.94886430638126484, 0.94756198278103243, 0.94624428468895538, \
+        0.94491126181265939, 0.94356296443786858, 0.94219944342650785, 0.94082075021478473, \
+        0.93942693681124823, 0.93801805579482855, 0.93659416031285159, 0.93515530407903558, \
+        0.93370154137146444, 0.93223292703053995, 0.93074951645691306, 0.92925136560939425, \
+        0.92773853100284287, 0.92621106970603395, 0.92466903933950717, 0.92311249807339191, \
+        0.92154150462521334, 0.9199561182576772, 0.91835639877643527, 0.91674240652782735, \
+        0.91511420239660668, 0.91347184780364221, 0.91181540470360189, 0.91014493558261544, \
+        0.908460503455917, 0.90676217186546892, 0.90505000487756337, 0.90332406708040658, \
+        0.90158442358168234, 0.8998311400060951, 0.89806428249289549, 0.89628391769338422, \
+        0.89449011276839929, 0.8926829353857807, 0.89086245371781914, 0.88902873643868396, \
+        0.88718185272183203, 0.88532187223739922, 0.88344886514957155, 0.88156290211393873, \
+        0.8796640542748283, 0.87775239326262278, 0.8758279911910567, 0.87389092065449647, \
+        0.87194125472520212, 0.8699790669505707, 0.86800443135036143, 0.86601742241390434, \
+        0.86401811509728943, 0.86200658482053927, 0.85998290746476469, 0.8579471593693011, \
+        0.85589941732882968, 0.85383975859047989, 0.85176826085091606, 0.84968500225340571, \
+        0.84759006138487214, 0.84548351727293003, 0.84336544938290414, 0.84123593761483129, \
+        0.83909506230044695, 0.83694290420015371, 0.83477954449997704, 0.83260506480849994, \
+        0.8304195471537863, 0.82822307398028494, 0.82601572814572288, 0.82379759291797461, \
+        0.82156875197192525, 0.819329289386312, 0.81707928964055387, 0.81481883761156304, \
+        0.81254801857054393, 0.81026691817977792, 0.80797562248938837, 0.80567421793409832, \
+        0.80336279132996724, 0.8010414298711187, 0.79871022112644807, 0.79636925303632089, \
+        0.79401861390925554, 0.79165839241859182, 0.78928867759914534, 0.78690955884384917, \
+        0.78452112590038259, 0.78212346886778394, 0.77971667819305324, 0.77730084466773808, \
+        0.77487605942451232, 0.7724424139337347, 0.77000000000000024, 0.76754890975867629, \
+        0.76508923567242793, 0.76262107052772921, 0.76014450743136119, 0.75765963980690421, \
+        0.7551665613912093, 0.75266536623086422, 0.75015614867864477, 0.74763900338995792, \
+        0.74511402531926663, 0.74258130971651215, 0.7400409521235185, 0.73749304837039009, \
+        0.73493769457189484, 0.73237498712383897, 0.7298050226994327, 0.72722789824563949, \
+        0.72464371097952252, 0.72205255838457538, 0.71945453820704608, 0.71684974845224825, \
+        0.71423828738086503, 0.71162025350524216, 0.70899574558567158, 0.70636486262666642, \
+        0.70372770387322525, 0.70108436880709024, 0.69843495714299175, 0.69577956882488901, \
+        0.69311830402219754, 0.69045126312601413, 0.68777854674532601, 0.68510025570321731, \
+        0.68241649103306667, 0.67972735397473349, 0.67703294597074104, 0.67433336866244731, \
+        0.67162872388621486, 0.66891911366956502, 0.66620464022733106, 0.66348540595780192, \
+        0.66076151343886114, 0.65803306542411333, 0.65530016483901143, 0.65256291477697426, \
+        0.64982141849549468, 0.64707577941224659, 0.64432610110118271, 0.64157248728862948, \
+        0.63881504184937021, 0.63605386880273029, 0.6332890723086515, 0.63052075666376406, \
+        0.62774902629745044, 0.62497398576790686, 0.62219573975820053, 0.61941439307231694, \
+        0.61663005063121035, 0.61384281746884317, 0.61105279872822582, 0.60826009965744832, \
+        0.60546482560571169, 0.60266708201935149, 0.59986697443786419, 0.59706460848992182, \
+        0.59426008988938905, 0.59145352443133625, 0.58864501798804636, 0.58583467650502319, \
+        0.58302260599699229, 0.58020891254390561, 0.57739370228693598, 0.57457708142447539, \
+        0.57175915620812745, 0.56894003293870166, 0.56611981796220034, 0.56329861766580791, \
+        0.56047653847387979, 0.55765368684392491, 0.5548301692625911, 0.55200609224164776, \
+        0.54918156231396942, 0.54635668602951326, 0.54353156995130392, 0.54070632065141089, \
+        0.53788104470693021, 0.53505584869596212, 0.53223083919359149, 0.5294061227678688, \
+        0.52658180597578674, 0.52375799535926393, 0.52093479744112403, 0.51811231872107855, \
+        0.51529066567170789, 0.51246994473444607, 0.50965026231556365, 0.50683172478215721, \
+        0.50401443845813343, 0.5011985096201993, 0.49838404449385443, 0.49557114924938173, \
+        0.49275992999784402, 0.48995049278707881, 0.48714294359770216, 0.48433738833910639, \
+        0.48153393284546714, 0.47873268287174991, 0.47593374408972255, 0.47313722208396675, \
+        0.47034322234789477, 0.46755185027977358, 0.46476321117874475, 0.46197741024085431, \
+        0.45919455255508373, 0.45641474309938751, 0.45363808673672917, 0.45086468821112935, \
+        0.4480946521437123, 0.44532808302876137, 0.44256508522977434, 0.43980576297552809, \
+        0.43705022035614821, 0.43429856131917854, 0.43155088966566379, 0.42880730904623138, \
+        0.42606792295718365, 0.42333283473659117, 0.42060214756039638, 0.41787596443851938, \
+        0.41515438821097567, 0.41243752154399299, 0.40972546692614004, 0.40701832666446136, \
+        0.4043162028806157, 0.40161919750702557, 0.39892741228302975, 0.3962409487510492, \
+        0.393559908252753, 0.39088439192523672, 0.38821450069720698, 0.38555033528517568, \
+        0.3828919961896583, 0.38023958369138267, 0.37759319784750955, 0.37495293848785405, \
+        0.37231890521112193, 0.36969119738115153, 0.36706991412316747, 0.36445515432003728, \
+        0.36184701660854512, 0.35924559937567008, 0.35665100075487288, 0.35406331862239582, \
+        0.35148265059356953, 0.34890909401913245, 0.34634274598155501, 0.34378370329138075, \
+        0.34123206248357252, 0.33868791981387231, 0.33615137125516831, 0.33362251249387576, \
+        0.33110143892632704, 0.32858824565517319, 0.32608302748579626, 0.32358587892273238, \
+        0.32109689416610843, 0.31861616710808649, 0.31614379132932341, 0.31367986009543863, \
+        0.31122446635349965, 0.30877770272851202, 0.3063396615199267, 0.30391043469815937, \
+        0.30149011390111879, 0.29907879043075192, 0.29667655524959735, 0.29428349897735756, \
+        0.29189971188747699, 0.28952528390373833, 0.28716030459686964, 0.28480486318116721, \
+        0.28245904851112669, 0.28012294907809432, 0.27779665300692813, 0.27548024805267263, \
+        0.27317382159724896, 0.27087746064615836, 0.26859125182520149, 0.26631528137720767, \
+        0.26404963515878449, 0.26179439863707715, 0.25954965688654613, 0.2573154945857557, \
+        0.25509199601418103, 0.25287924504902964, 0.25067732516207447, 0.24848631941650806, \
+        0.24630631046380758, 0.2441373805406179, 0.24197961146564811, 0.23983308463658642, \
+        0.23769788102702766, 0.23557408118342166, 0.23346176522203216, 0.23136101282591531, \
+        0.22927190324191504, 0.22719451527767176, 0.22512892729865069, 0.2230752172251842, \
+        0.22103346252953548, 0.21900374023297264, 0.21698612690286517, 0.21498069864979469, \
+        0.21298753112468544, 0.21100669951594753, 0.2090382785466432, 0.20708234247166779, \
+        0.20513896507494711, 0.20320821966665542, 0.20129017908044911, 0.1993849156707207, \
+        0.19749250130986662, 0.1956130073855788, 0.19374650479815009, 0.19189306395780087, \
+        0.19005275478202138, 0.18822564669293518, 0.18641180861468121, 0.18461130897081118, \
+        0.1828242156817112, 0.18105059616203772, 0.17929051731817613, 0.17754404554571496, \
+        0.1758112467269427, 0.17409218622836092, 0.17238692889822105, 0.17069553906407553, \
+        0.16901808053035217, 0.16735461657594802, 0.16570520995184074, 0.16406992287872285, \
+        0.16244881704465292, 0.16084195360273107, 0.1592493931687895, 0.15767119581910727, \
+        0.15610742108814357, 0.15455812796629265, 0.15302337489765688, 0.15150321977784365, \
+        0.14999771995178113, 0.14850693221155431, 0.147030912794263, 0.14556971737990043, \
+        0.14412340108925353, 0.14269201848182184, 0.14127562355376094, 0.13987426973584499, \
+        0.13848800989145155, 0.13711689631456653, 0.13576098072781206, 0.13442031428049617, \
+        0.13309494754668105, 0.13178493052327778, 0.13049031262815824, 0.12921114269829287, \
+        0.1279474689879066, 0.12669933916665943, 0.12546680031784768, 0.12424989893662908, \
+        0.12304868092826737, 0.12186319160640113, 0.12069347569133498, 0.11953957730835185, \
+        0.11840153998604869, 0.11727940665469394, 0.11617321964460969, 0.11508302068457288, \
+        0.11400885090024226, 0.11295075081260658, 0.1119087603364568, 0.11088291877887901, \
+        0.1098732648377726, 0.10887983660039074, 0.10790267154190275, 0.10694180652398066, \
+        0.10599727779340906, 0.1050691209807178, 0.10415737109883699, 0.10326206254177706, \
+        0.10238322908333147, 0.10152090387580187, 0.10067511944874802, 0.099845907707760362, \
+        0.099033299933257213, 0.098237326779303524, 0.097458018272455371, 0.096695403810627245, \
+        0.095949512161982886, 0.095220371463849929, 0.094508009221658751, 0.093812452307904637, \
+        0.093133726961134256, 0.092471858784955785, 0.091826872747072852, 0.091198793178343451, \
+        0.090587643771861015, 0.089993447582061348, 0.089416227023852546, 0.088856003871770228, \
+        0.088312799259154973, 0.087786633677355952, 0.08727752697495772, 0.08678549835703131, \
+        0.086310566384409981, 0.085852748972988613, 0.085412063393048743, 0.084988526268605979, \
+        0.084582153576783725, 0.084192960647210102, 0.08382096216143986, 0.083466172152400209, \
+        0.083128604003861739, 0.082808270449933663, 0.082505183574583141, 0.082219354811179424, \
+        0.081950794942062921, 0.081699514098138026, 0.081465521758491311, 0.081248826750033698, \
+        0.081049437247167455, 0.080867360771478214, 0.080702604191450644, 0.080555173722209883, \
+        0.080425074925286777, 0.080312312708408273, 0.080216891325311956, 0.080138814375586065, \
+        0.080078084804533267, 0.080034704903059861, 0.080008676307589288, 0.080000000000000016 \
+    }
+
+#endif // FFT_TABLES_1024_H
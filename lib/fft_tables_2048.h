@@ -0,0 +1,1174 @@
+// このファイルは tools/gen_fft_tables.c で生成（手で編集しないこと）
+// 使い方: ./gen_fft_tables 2048 > fft_tables_2048.h
+#ifndef FFT_TABLES_2048_H
+#define FFT_TABLES_2048_H
+
+#define FFT_TABLE_2048_COS \
+    { \
+        1, 0.99999529380957619, 0.99998117528260111, 0.9999576445519639, \
+        0.9999247018391445, 0.99988234745421256, 0.9998305817958234, 0.99976940535121528, \
+        0.99969881869620425, 0.99961882249517864, 0.99952941750109314, 0.99943060455546173, \
+        0.99932238458834954, 0.99920475861836389, 0.99907772775264536, 0.99894129318685687, \
+        0.99879545620517241, 0.99864021818026527, 0.99847558057329477, 0.99830154493389289, \
+        0.99811811290014918, 0.997925286198596, 0.99772306664419164, 0.99751145614030345, \
+        0.99729045667869021, 0.99706007033948296, 0.99682029929116567, 0.99657114579055484, \
+        0.996312612182778, 0.99604470090125197, 0.99576741446765982, 0.99548075549192694, \
+        0.99518472667219693, 0.99487933079480562, 0.99456457073425542, 0.9942404494531879, \
+        0.99390697000235606, 0.9935641355205953, 0.9932119492347945, 0.9928504144598651, \
+        0.99247953459870997, 0.9920993131421918, 0.99170975366909953, 0.99131085984611544, \
+        0.99090263542778001, 0.99048508425645709, 0.99005821026229712, 0.98962201746320089, \
+        0.98917650996478101, 0.98872169196032378, 0.98825756773074946, 0.98778414164457218, \
+        0.98730141815785843, 0.98680940181418553, 0.98630809724459867, 0.98579750916756748, \
+        0.98527764238894122, 0.98474850180190421, 0.98421009238692903, 0.98366241921173025, \
+        0.98310548743121629, 0.98253930228744124, 0.98196386910955524, 0.98137919331375456, \
+        0.98078528040323043, 0.98018213596811743, 0.97956976568544052, 0.9789481753190622, \
+        0.97831737071962765, 0.97767735782450993, 0.97702814265775439, 0.97636973133002114, \
+        0.97570213003852857, 0.97502534506699412, 0.97433938278557586, 0.97364424965081198, \
+        0.97293995220556018, 0.97222649707893627, 0.97150389098625178, 0.97077214072895035, \
+        0.97003125319454397, 0.96928123535654853, 0.96852209427441738, 0.96775383709347551, \
+        0.96697647104485207, 0.9661900034454125, 0.9653944416976894, 0.96458979328981276, \
+        0.96377606579543984, 0.96295326687368388, 0.96212140426904158, 0.96128048581132064, \
+        0.96043051941556579, 0.95957151308198452, 0.9587034748958716, 0.95782641302753291, \
+        0.95694033573220882, 0.95604525134999641, 0.95514116830577078, 0.95422809510910567, \
+        0.95330604035419386, 0.95237501271976588, 0.95143502096900834, 0.9504860739494817, \
+        0.94952818059303667, 0.94856134991573027, 0.94758559101774109, 0.94660091308328353, \
+        0.94560732538052128, 0.94460483726148026, 0.94359345816196039, 0.94257319760144687, \
+        0.94154406518302081, 0.9405060705932683, 0.93945922360218992, 0.93840353406310806, \
+        0.93733901191257496, 0.93626566717027826, 0.93518350993894761, 0.93409255040425898, \
+        0.93299279883473896, 0.93188426558166815, 0.93076696107898371, 0.92964089584318133, \
+        0.92850608047321559, 0.92736252565040111, 0.92621024213831138, 0.92504924078267758, \
+        0.92387953251128674, 0.92270112833387863, 0.92151403934204201, 0.92031827670911059, \
+        0.91911385169005777, 0.9179007756213905, 0.9166790599210427, 0.91544871608826783, \
+        0.91420975570353069, 0.91296219042839821, 0.91170603200542988, 0.91044129225806725, \
+        0.90916798309052238, 0.90788611648766626, 0.90659570451491533, 0.90529675931811882, \
+        0.90398929312344334, 0.90267331823725883, 0.90134884704602203, 0.90001589201616028, \
+        0.89867446569395382, 0.89732458070541832, 0.89596624975618522, 0.8945994856313827, \
+        0.89322430119551532, 0.89184070939234272, 0.89044872324475788, 0.88904835585466457, \
+        0.88763962040285393, 0.88622253014888064, 0.88479709843093779, 0.88336333866573158, \
+        0.88192126434835505, 0.88047088905216075, 0.87901222642863353, 0.87754529020726135, \
+        0.8760700941954066, 0.87458665227817611, 0.87309497841829009, 0.87159508665595098, \
+        0.87008699110871146, 0.8685707059713409, 0.86704624551569265, 0.86551362409056909, \
+        0.86397285612158681, 0.86242395611104061, 0.86086693863776731, 0.85930181835700847, \
+        0.85772861000027212, 0.85614732837519447, 0.85455798836540053, 0.85296060493036363, \
+        0.8513551931052652, 0.84974176800085255, 0.84812034480329723, 0.84649093877405213, \
+        0.84485356524970712, 0.84320823964184544, 0.84155497743689844, 0.83989379419599952, \
+        0.83822470555483808, 0.83654772722351201, 0.83486287498638001, 0.83317016470191319, \
+        0.83146961230254524, 0.82976123379452305, 0.8280450452577558, 0.82632106284566353, \
+        0.82458930278502529, 0.82284978137582643, 0.82110251499110465, 0.8193475200767969, \
+        0.81758481315158371, 0.81581441080673378, 0.81403632970594841, 0.81225058658520388, \
+        0.81045719825259477, 0.80865618158817498, 0.80684755354379933, 0.80503133114296366, \
+        0.80320753148064494, 0.80137617172314024, 0.79953726910790501, 0.79769084094339116, \
+        0.79583690460888357, 0.79397547755433717, 0.79210657730021239, 0.79023022143731003, \
+        0.78834642762660634, 0.78645521359908577, 0.78455659715557524, 0.78265059616657573, \
+        0.78073722857209449, 0.77881651238147598, 0.77688846567323244, 0.77495310659487393, \
+        0.77301045336273699, 0.77106052426181382, 0.7691033376455797, 0.7671389119358204, \
+        0.76516726562245896, 0.76318841726338127, 0.76120238548426178, 0.75920918897838807, \
+        0.75720884650648457, 0.75520137689653655, 0.75318679904361252, 0.75116513190968648, \
+        0.74913639452345937, 0.74710060598018013, 0.74505778544146606, 0.74300795213512172, \
+        0.74095112535495911, 0.73888732446061511, 0.7368165688773699, 0.7347388780959635, \
+        0.73265427167241282, 0.73056276922782759, 0.7284643904482252, 0.72635915508434601, \
+        0.724247082951467, 0.72212819392921535, 0.72000250796138165, 0.71787004505573171, \
+        0.71573082528381859, 0.71358486878079364, 0.71143219574521643, 0.70927282643886569, \
+        0.70710678118654757, 0.70493408037590499, 0.7027547444572253, 0.70056879394324845, \
+        0.69837624940897292, 0.69617713149146299, 0.693971460889654, 0.69175925836415775, \
+        0.68954054473706694, 0.68731534089175916, 0.68508366777270036, 0.68284554638524808, \
+        0.68060099779545313, 0.67835004312986158, 0.67609270357531603, 0.67382900037875615, \
+        0.67155895484701833, 0.66928258834663601, 0.66699992230363747, 0.6647109782033449, \
+        0.66241577759017178, 0.66011434206742048, 0.65780669329707864, 0.65549285299961546, \
+        0.65317284295377676, 0.65084668499638099, 0.64851440102211255, 0.64617601298331639, \
+        0.6438315428897915, 0.64148101280858316, 0.63912444486377573, 0.6367618612362842, \
+        0.63439328416364549, 0.63201873593980906, 0.6296382389149271, 0.62725181549514419, \
+        0.62485948814238645, 0.62246127937415008, 0.62005721176328921, 0.61764730793780398, \
+        0.61523159058062682, 0.61281008242940971, 0.61038280627630948, 0.60794978496777374, \
+        0.60551104140432555, 0.60306659854034828, 0.60061647938386897, 0.59816070699634238, \
+        0.59569930449243347, 0.5932322950397998, 0.59075970185887428, 0.58828154822264533, \
+        0.58579785745643886, 0.58330865293769829, 0.58081395809576453, 0.57831379641165559, \
+        0.57580819141784534, 0.57329716669804232, 0.57078074588696737, 0.56825895267013149, \
+        0.56573181078361323, 0.56319934401383409, 0.56066157619733603, 0.5581185312205561, \
+        0.55557023301960229, 0.55301670558002758, 0.55045797293660481, 0.54789405917310019, \
+        0.54532498842204646, 0.542750784864516, 0.54017147272989297, 0.53758707629564551, \
+        0.53499761988709726, 0.53240312787719801, 0.52980362468629483, 0.52719913478190139, \
+        0.52458968267846884, 0.52197529293715439, 0.51935599016558953, 0.51673179901764998, \
+        0.51410274419322166, 0.51146885043797052, 0.50883014254310699, 0.50618664534515545, \
+        0.50353838372571758, 0.50088538261124094, 0.49822766697278187, 0.49556526182577249, \
+        0.49289819222978409, 0.4902264832882911, 0.48755016014843605, 0.48486924800079112, \
+        0.48218377207912283, 0.47949375766015301, 0.47679923006332225, 0.47410021465055002, \
+        0.47139673682599781, 0.46868882203582796, 0.46597649576796613, 0.46325978355186026, \
+        0.46053871095824001, 0.45781330359887729, 0.45508358712634384, 0.452349587233771, \
+        0.4496113296546066, 0.44686884016237433, 0.44412214457042926, 0.44137126873171662, \
+        0.43861623853852771, 0.43585707992225547, 0.43309381885315201, 0.43032648134008261, \
+        0.4275550934302822, 0.42477968120910881, 0.42200027079979979, 0.41921688836322396, \
+        0.41642956009763732, 0.41363831223843456, 0.41084317105790391, 0.40804416286497874, \
+        0.40524131400498986, 0.40243465085941854, 0.39962419984564679, 0.39680998741671042, \
+        0.3939920400610481, 0.39117038430225398, 0.3883450466988263, 0.38551605384391902, \
+        0.38268343236508984, 0.37984720892405111, 0.37700741021641831, 0.37416406297145799, \
+        0.3713171939518376, 0.36846682995337232, 0.36561299780477396, 0.36275572436739723, \
+        0.35989503653498828, 0.35703096123343003, 0.35416352542049051, 0.35129275608556715, \
+        0.34841868024943451, 0.34554132496398915, 0.34266071731199438, 0.33977688440682696, \
+        0.33688985339222005, 0.33399965144200949, 0.33110630575987643, 0.32820984357909266, \
+        0.32531029216226298, 0.32240767880107002, 0.31950203081601575, 0.31659337555616585, \
+        0.31368174039889157, 0.31076715274961147, 0.30784964004153498, 0.30492922973540243, \
+        0.3020059493192282, 0.29907982630804048, 0.29615088824362396, 0.29321916269425868, \
+        0.29028467725446233, 0.28734745954472957, 0.28440753721127182, 0.28146493792575805, \
+        0.27851968938505306, 0.27557181931095825, 0.27262135544994898, 0.2696683255729152, \
+        0.26671275747489842, 0.26375467897483151, 0.26079411791527557, 0.25783110216215893, \
+        0.25486565960451463, 0.25189781815421691, 0.24892760574572026, 0.24595505033579459, \
+        0.24298017990326398, 0.2400030224487415, 0.23702360599436734, 0.23404195858354346, \
+        0.23105810828067128, 0.22807208317088579, 0.22508391135979278, 0.22209362097320359, \
+        0.21910124015686977, 0.2161067970762196, 0.21311031991609136, 0.21011183688046972, \
+        0.20711137619221856, 0.20410896609281701, 0.20110463484209196, 0.19809841071795373, \
+        0.19509032201612833, 0.19208039704989238, 0.18906866414980628, 0.18605515166344663, \
+        0.18303988795514106, 0.18002290140569951, 0.17700422041214886, 0.17398387338746385, \
+        0.17096188876030136, 0.16793829497473123, 0.16491312048997009, 0.16188639378011188, \
+        0.15885814333386139, 0.15582839765426532, 0.15279718525844341, 0.14976453467732162, \
+        0.14673047445536175, 0.14369503315029458, 0.14065823933284924, 0.13762012158648618, \
+        0.13458070850712622, 0.13154002870288328, 0.12849811079379322, 0.12545498341154621, \
+        0.12241067519921628, 0.11936521481099135, 0.11631863091190488, 0.11327095217756436, \
+        0.11022220729388318, 0.10717242495680887, 0.10412163387205473, 0.10106986275482788, \
+        0.09801714032956077, 0.094963495329639061, 0.091908956497132696, 0.088853552582524684, \
+        0.08579731234443988, 0.082740264549375803, 0.079682437971430126, 0.076623861392031617, \
+        0.073564563599667454, 0.070504573389614009, 0.067443919563664106, 0.06438263092985741, \
+        0.061320736302208648, 0.058258264500435732, 0.055195244349690031, 0.052131704680283317, \
+        0.049067674327418126, 0.046003182130914644, 0.042938256934940959, 0.039872927587739845, \
+        0.036807222941358991, 0.033741171851377642, 0.030674803176636581, 0.02760814577896582, \
+        0.024541228522912264, 0.021474080275469605, 0.01840672990580482, 0.01533920628498822, \
+        0.012271538285719944, 0.0092037547820599599, 0.0061358846491545152, 0.0030679567629661379, \
+        6.123233995736766e-17, -0.0030679567629660156, -0.0061358846491543929, -0.0092037547820598368, \
+        -0.012271538285719823, -0.015339206284988098, -0.018406729905804695, -0.021474080275469484, \
+        -0.024541228522912142, -0.027608145778965698, -0.030674803176636459, -0.033741171851377517, \
+        -0.036807222941358866, -0.039872927587739727, -0.042938256934940834, -0.046003182130914519, \
+        -0.049067674327418008, -0.052131704680283192, -0.055195244349689913, -0.058258264500435607, \
+        -0.06132073630220853, -0.064382630929857285, -0.067443919563663982, -0.070504573389613898, \
+        -0.073564563599667329, -0.076623861392031506, -0.079682437971430015, -0.082740264549375678, \
+        -0.085797312344439755, -0.088853552582524559, -0.091908956497132571, -0.09496349532963895, \
+        -0.098017140329560645, -0.10106986275482775, -0.1041216338720546, -0.10717242495680876, \
+        -0.11022220729388306, -0.11327095217756424, -0.11631863091190475, -0.11936521481099123, \
+        -0.12241067519921615, -0.12545498341154607, -0.12849811079379311, -0.13154002870288314, \
+        -0.13458070850712611, -0.13762012158648607, -0.14065823933284913, -0.14369503315029444, \
+        -0.14673047445536164, -0.14976453467732151, -0.1527971852584433, -0.1558283976542652, \
+        -0.15885814333386128, -0.16188639378011177, -0.16491312048996995, -0.16793829497473109, \
+        -0.17096188876030124, -0.17398387338746371, -0.17700422041214875, -0.1800229014056994, \
+        -0.18303988795514092, -0.18605515166344649, -0.18906866414980616, -0.19208039704989227, \
+        -0.19509032201612819, -0.19809841071795362, -0.20110463484209182, -0.2041089660928169, \
+        -0.20711137619221845, -0.21011183688046961, -0.21311031991609125, -0.21610679707621949, \
+        -0.21910124015686966, -0.22209362097320348, -0.22508391135979267, -0.22807208317088568, \
+        -0.23105810828067114, -0.23404195858354332, -0.23702360599436723, -0.24000302244874139, \
+        -0.24298017990326387, -0.24595505033579448, -0.24892760574572012, -0.2518978181542168, \
+        -0.25486565960451452, -0.25783110216215882, -0.26079411791527546, -0.2637546789748314, \
+        -0.26671275747489831, -0.26966832557291509, -0.27262135544994887, -0.27557181931095814, \
+        -0.27851968938505295, -0.28146493792575794, -0.28440753721127171, -0.28734745954472946, \
+        -0.29028467725446216, -0.29321916269425857, -0.29615088824362384, -0.29907982630804036, \
+        -0.30200594931922808, -0.30492922973540226, -0.30784964004153487, -0.31076715274961136, \
+        -0.31368174039889141, -0.31659337555616573, -0.31950203081601564, -0.32240767880106985, \
+        -0.32531029216226287, -0.32820984357909255, -0.33110630575987632, -0.33399965144200938, \
+        -0.33688985339221994, -0.33977688440682685, -0.34266071731199427, -0.34554132496398904, \
+        -0.3484186802494344, -0.35129275608556704, -0.3541635254204904, -0.35703096123342992, \
+        -0.35989503653498817, -0.36275572436739711, -0.36561299780477385, -0.36846682995337221, \
+        -0.37131719395183749, -0.37416406297145788, -0.3770074102164182, -0.37984720892405099, \
+        -0.38268343236508973, -0.3855160538439189, -0.38834504669882619, -0.39117038430225387, \
+        -0.39399204006104799, -0.39680998741671031, -0.39962419984564668, -0.40243465085941843, \
+        -0.40524131400498975, -0.40804416286497863, -0.4108431710579038, -0.41363831223843445, \
+        -0.41642956009763699, -0.41921688836322407, -0.42200027079979968, -0.42477968120910869, \
+        -0.42755509343028186, -0.43032648134008272, -0.4330938188531519, -0.43585707992225536, \
+        -0.43861623853852738, -0.44137126873171673, -0.44412214457042914, -0.44686884016237399, \
+        -0.44961132965460671, -0.45234958723377089, -0.45508358712634372, -0.45781330359887701, \
+        -0.46053871095824006, -0.46325978355186015, -0.46597649576796601, -0.46868882203582768, \
+        -0.4713967368259977, -0.47410021465054991, -0.47679923006332192, -0.47949375766015312, \
+        -0.48218377207912272, -0.48486924800079101, -0.48755016014843572, -0.49022648328829121, \
+        -0.49289819222978398, -0.49556526182577237, -0.49822766697278159, -0.50088538261124083, \
+        -0.50353838372571746, -0.50618664534515512, -0.5088301425431071, -0.51146885043797041, \
+        -0.51410274419322166, -0.51673179901764965, -0.51935599016558964, -0.52197529293715428, \
+        -0.52458968267846873, -0.52719913478190106, -0.52980362468629472, -0.5324031278771979, \
+        -0.53499761988709704, -0.53758707629564562, -0.54017147272989285, -0.54275078486451578, \
+        -0.54532498842204624, -0.54789405917310019, -0.5504579729366047, -0.55301670558002736, \
+        -0.55557023301960196, -0.5581185312205561, -0.56066157619733592, -0.56319934401383398, \
+        -0.56573181078361323, -0.56825895267013149, -0.57078074588696714, -0.57329716669804198, \
+        -0.57580819141784534, -0.57831379641165548, -0.58081395809576442, -0.5833086529376984, \
+        -0.58579785745643886, -0.58828154822264522, -0.59075970185887405, -0.59323229503979991, \
+        -0.59569930449243336, -0.59816070699634216, -0.60061647938386875, -0.60306659854034828, \
+        -0.60551104140432543, -0.60794978496777352, -0.61038280627630959, -0.61281008242940971, \
+        -0.61523159058062671, -0.61764730793780376, -0.62005721176328921, -0.62246127937414997, \
+        -0.62485948814238623, -0.62725181549514386, -0.6296382389149271, -0.63201873593980895, \
+        -0.63439328416364538, -0.63676186123628431, -0.63912444486377573, -0.64148101280858305, \
+        -0.64383154288979128, -0.64617601298331639, -0.64851440102211244, -0.65084668499638076, \
+        -0.65317284295377653, -0.65549285299961546, -0.65780669329707864, -0.66011434206742037, \
+        -0.66241577759017189, -0.6647109782033449, -0.66699992230363736, -0.6692825883466359, \
+        -0.67155895484701844, -0.67382900037875604, -0.67609270357531581, -0.67835004312986125, \
+        -0.68060099779545302, -0.68284554638524797, -0.68508366777270024, -0.68731534089175916, \
+        -0.68954054473706694, -0.69175925836415764, -0.69397146088965378, -0.69617713149146299, \
+        -0.6983762494089728, -0.70056879394324822, -0.70275474445722508, -0.70493408037590488, \
+        -0.70710678118654746, -0.70927282643886547, -0.71143219574521654, -0.71358486878079364, \
+        -0.71573082528381859, -0.7178700450557316, -0.72000250796138165, -0.72212819392921523, \
+        -0.72424708295146678, -0.72635915508434579, -0.7284643904482252, -0.73056276922782748, \
+        -0.7326542716724127, -0.7347388780959635, -0.7368165688773699, -0.738887324460615, \
+        -0.74095112535495888, -0.74300795213512172, -0.74505778544146595, -0.74710060598018002, \
+        -0.74913639452345915, -0.75116513190968648, -0.75318679904361241, -0.75520137689653644, \
+        -0.75720884650648457, -0.75920918897838807, -0.76120238548426167, -0.76318841726338105, \
+        -0.76516726562245896, -0.76713891193582029, -0.76910333764557948, -0.7710605242618136, \
+        -0.77301045336273699, -0.77495310659487382, -0.77688846567323233, -0.77881651238147598, \
+        -0.78073722857209449, -0.78265059616657562, -0.78455659715557502, -0.78645521359908577, \
+        -0.78834642762660623, -0.79023022143730992, -0.79210657730021217, -0.79397547755433717, \
+        -0.79583690460888346, -0.79769084094339093, -0.79953726910790512, -0.80137617172314024, \
+        -0.80320753148064483, -0.80503133114296344, -0.80684755354379933, -0.80865618158817498, \
+        -0.81045719825259466, -0.81225058658520377, -0.81403632970594841, -0.81581441080673367, \
+        -0.8175848131515836, -0.81934752007679701, -0.82110251499110465, -0.82284978137582621, \
+        -0.82458930278502507, -0.82632106284566353, -0.82804504525775569, -0.82976123379452293, \
+        -0.83146961230254535, -0.83317016470191319, -0.83486287498638001, -0.83654772722351189, \
+        -0.83822470555483808, -0.83989379419599952, -0.84155497743689833, -0.84320823964184533, \
+        -0.84485356524970712, -0.84649093877405202, -0.84812034480329712, -0.84974176800085255, \
+        -0.8513551931052652, -0.85296060493036363, -0.85455798836540042, -0.85614732837519447, \
+        -0.85772861000027201, -0.85930181835700836, -0.86086693863776709, -0.8624239561110405, \
+        -0.8639728561215867, -0.86551362409056898, -0.86704624551569276, -0.8685707059713409, \
+        -0.87008699110871135, -0.87159508665595087, -0.87309497841829009, -0.87458665227817611, \
+        -0.87607009419540649, -0.87754529020726113, -0.87901222642863353, -0.88047088905216075, \
+        -0.88192126434835494, -0.88336333866573169, -0.88479709843093779, -0.88622253014888053, \
+        -0.88763962040285382, -0.88904835585466457, -0.89044872324475788, -0.89184070939234261, \
+        -0.89322430119551521, -0.8945994856313827, -0.89596624975618511, -0.89732458070541821, \
+        -0.89867446569395393, -0.90001589201616017, -0.90134884704602192, -0.90267331823725871, \
+        -0.90398929312344334, -0.9052967593181187, -0.90659570451491533, -0.90788611648766604, \
+        -0.90916798309052238, -0.91044129225806714, -0.91170603200542977, -0.91296219042839821, \
+        -0.91420975570353069, -0.91544871608826772, -0.91667905992104259, -0.9179007756213905, \
+        -0.91911385169005777, -0.92031827670911048, -0.92151403934204179, -0.92270112833387863, \
+        -0.92387953251128674, -0.92504924078267747, -0.92621024213831138, -0.92736252565040111, \
+        -0.92850608047321548, -0.92964089584318121, -0.93076696107898371, -0.93188426558166804, \
+        -0.93299279883473885, -0.93409255040425876, -0.93518350993894761, -0.93626566717027826, \
+        -0.93733901191257485, -0.93840353406310817, -0.93945922360218992, -0.9405060705932683, \
+        -0.9415440651830207, -0.94257319760144687, -0.94359345816196039, -0.94460483726148015, \
+        -0.94560732538052117, -0.94660091308328353, -0.94758559101774109, -0.94856134991573027, \
+        -0.94952818059303667, -0.9504860739494817, -0.95143502096900834, -0.95237501271976577, \
+        -0.95330604035419386, -0.95422809510910556, -0.95514116830577067, -0.95604525134999629, \
+        -0.95694033573220882, -0.95782641302753291, -0.95870347489587149, -0.95957151308198452, \
+        -0.96043051941556579, -0.96128048581132064, -0.96212140426904147, -0.96295326687368388, \
+        -0.96377606579543984, -0.96458979328981265, -0.96539444169768929, -0.9661900034454125, \
+        -0.96697647104485207, -0.9677538370934754, -0.96852209427441738, -0.96928123535654842, \
+        -0.97003125319454397, -0.97077214072895024, -0.97150389098625178, -0.97222649707893627, \
+        -0.97293995220556007, -0.97364424965081187, -0.97433938278557586, -0.97502534506699412, \
+        -0.97570213003852846, -0.97636973133002114, -0.97702814265775439, -0.97767735782450993, \
+        -0.97831737071962754, -0.9789481753190622, -0.97956976568544052, -0.98018213596811732, \
+        -0.98078528040323043, -0.98137919331375456, -0.98196386910955524, -0.98253930228744124, \
+        -0.98310548743121629, -0.98366241921173025, -0.98421009238692903, -0.98474850180190421, \
+        -0.98527764238894122, -0.98579750916756737, -0.98630809724459856, -0.98680940181418553, \
+        -0.98730141815785843, -0.98778414164457218, -0.98825756773074946, -0.98872169196032378, \
+        -0.98917650996478101, -0.98962201746320078, -0.99005821026229701, -0.99048508425645709, \
+        -0.99090263542778001, -0.99131085984611544, -0.99170975366909953, -0.9920993131421918, \
+        -0.99247953459870997, -0.9928504144598651, -0.9932119492347945, -0.9935641355205953, \
+        -0.99390697000235606, -0.9942404494531879, -0.99456457073425542, -0.99487933079480562, \
+        -0.99518472667219682, -0.99548075549192694, -0.99576741446765982, -0.99604470090125197, \
+        -0.996312612182778, -0.99657114579055484, -0.99682029929116567, -0.99706007033948296, \
+        -0.99729045667869021, -0.99751145614030345, -0.99772306664419164, -0.997925286198596, \
+        -0.99811811290014918, -0.99830154493389289, -0.99847558057329477, -0.99864021818026516, \
+        -0.99879545620517241, -0.99894129318685687, -0.99907772775264536, -0.99920475861836389, \
+        -0.99932238458834954, -0.99943060455546173, -0.99952941750109314, -0.99961882249517864, \
+        -0.99969881869620425, -0.99976940535121528, -0.9998305817958234, -0.99988234745421256, \
+        -0.9999247018391445, -0.9999576445519639, -0.99998117528260111, -0.99999529380957619 \
+    }
+
+#define FFT_TABLE_2048_SIN \
+    { \
+        0, 0.0030679567629659761, 0.0061358846491544753, 0.0092037547820598194, \
+        0.012271538285719925, 0.0153392062849881, 0.01840672990580482, 0.021474080275469508, \
+        0.024541228522912288, 0.02760814577896574, 0.030674803176636626, 0.03374117185137758, \
+        0.036807222941358832, 0.039872927587739811, 0.04293825693494082, 0.046003182130914623, \
+        0.049067674327418015, 0.052131704680283324, 0.055195244349689934, 0.058258264500435752, \
+        0.061320736302208578, 0.064382630929857465, 0.067443919563664051, 0.070504573389613856, \
+        0.073564563599667426, 0.076623861392031492, 0.079682437971430126, 0.082740264549375692, \
+        0.085797312344439894, 0.0888535525825246, 0.091908956497132724, 0.094963495329638992, \
+        0.098017140329560604, 0.10106986275482782, 0.10412163387205459, 0.10717242495680884, \
+        0.11022220729388306, 0.11327095217756435, 0.11631863091190475, 0.11936521481099135, \
+        0.1224106751992162, 0.12545498341154623, 0.12849811079379317, 0.13154002870288312, \
+        0.13458070850712617, 0.13762012158648604, 0.14065823933284921, 0.14369503315029447, \
+        0.14673047445536175, 0.14976453467732151, 0.15279718525844344, 0.15582839765426523, \
+        0.15885814333386145, 0.16188639378011183, 0.16491312048996992, 0.16793829497473117, \
+        0.17096188876030122, 0.17398387338746382, 0.17700422041214875, 0.18002290140569951, \
+        0.18303988795514095, 0.18605515166344663, 0.18906866414980619, 0.19208039704989244, \
+        0.19509032201612825, 0.19809841071795356, 0.2011046348420919, 0.20410896609281687, \
+        0.20711137619221856, 0.21011183688046961, 0.21311031991609136, 0.21610679707621952, \
+        0.2191012401568698, 0.22209362097320351, 0.22508391135979283, 0.22807208317088573, \
+        0.23105810828067111, 0.23404195858354343, 0.2370236059943672, 0.2400030224487415, \
+        0.24298017990326387, 0.24595505033579459, 0.24892760574572015, 0.25189781815421697, \
+        0.25486565960451457, 0.25783110216215899, 0.26079411791527551, 0.26375467897483135, \
+        0.26671275747489837, 0.26966832557291509, 0.27262135544994898, 0.27557181931095814, \
+        0.27851968938505306, 0.28146493792575794, 0.28440753721127188, 0.28734745954472951, \
+        0.29028467725446233, 0.29321916269425863, 0.29615088824362379, 0.29907982630804048, \
+        0.30200594931922808, 0.30492922973540237, 0.30784964004153487, 0.31076715274961147, \
+        0.31368174039889152, 0.31659337555616585, 0.31950203081601569, 0.32240767880106985, \
+        0.32531029216226293, 0.3282098435790925, 0.33110630575987643, 0.33399965144200938, \
+        0.33688985339222005, 0.33977688440682685, 0.34266071731199438, 0.34554132496398909, \
+        0.34841868024943456, 0.35129275608556709, 0.35416352542049034, 0.35703096123342998, \
+        0.35989503653498811, 0.36275572436739723, 0.36561299780477385, 0.36846682995337232, \
+        0.37131719395183754, 0.37416406297145793, 0.37700741021641826, 0.37984720892405116, \
+        0.38268343236508978, 0.38551605384391885, 0.38834504669882625, 0.39117038430225387, \
+        0.3939920400610481, 0.39680998741671031, 0.39962419984564679, 0.40243465085941843, \
+        0.40524131400498986, 0.40804416286497869, 0.41084317105790391, 0.4136383122384345, \
+        0.41642956009763715, 0.41921688836322391, 0.42200027079979968, 0.42477968120910881, \
+        0.42755509343028208, 0.43032648134008261, 0.43309381885315196, 0.43585707992225547, \
+        0.43861623853852766, 0.44137126873171667, 0.4441221445704292, 0.44686884016237416, \
+        0.44961132965460654, 0.45234958723377089, 0.45508358712634384, 0.45781330359887717, \
+        0.46053871095824001, 0.46325978355186015, 0.46597649576796618, 0.4686888220358279, \
+        0.47139673682599764, 0.47410021465054997, 0.47679923006332209, 0.47949375766015301, \
+        0.48218377207912272, 0.48486924800079106, 0.487550160148436, 0.49022648328829116, \
+        0.49289819222978404, 0.49556526182577254, 0.49822766697278187, 0.50088538261124071, \
+        0.50353838372571758, 0.50618664534515523, 0.50883014254310699, 0.5114688504379703, \
+        0.51410274419322166, 0.51673179901764987, 0.51935599016558964, 0.52197529293715439, \
+        0.52458968267846895, 0.52719913478190128, 0.52980362468629461, 0.5324031278771979, \
+        0.53499761988709715, 0.53758707629564539, 0.54017147272989285, 0.54275078486451589, \
+        0.54532498842204646, 0.54789405917310019, 0.55045797293660481, 0.55301670558002747, \
+        0.55557023301960218, 0.5581185312205561, 0.56066157619733603, 0.56319934401383409, \
+        0.56573181078361312, 0.56825895267013149, 0.57078074588696726, 0.5732971666980422, \
+        0.57580819141784534, 0.57831379641165559, 0.58081395809576453, 0.58330865293769829, \
+        0.58579785745643886, 0.58828154822264522, 0.59075970185887416, 0.5932322950397998, \
+        0.59569930449243336, 0.59816070699634227, 0.60061647938386897, 0.60306659854034816, \
+        0.60551104140432555, 0.60794978496777363, 0.61038280627630948, 0.61281008242940971, \
+        0.61523159058062682, 0.61764730793780387, 0.6200572117632891, 0.62246127937414997, \
+        0.62485948814238634, 0.62725181549514408, 0.62963823891492698, 0.63201873593980906, \
+        0.63439328416364549, 0.6367618612362842, 0.63912444486377573, 0.64148101280858316, \
+        0.64383154288979139, 0.64617601298331628, 0.64851440102211244, 0.65084668499638088, \
+        0.65317284295377676, 0.65549285299961535, 0.65780669329707864, 0.66011434206742048, \
+        0.66241577759017178, 0.66471097820334479, 0.66699992230363747, 0.66928258834663601, \
+        0.67155895484701833, 0.67382900037875604, 0.67609270357531592, 0.67835004312986147, \
+        0.68060099779545302, 0.68284554638524808, 0.68508366777270036, 0.68731534089175905, \
+        0.68954054473706683, 0.69175925836415775, 0.693971460889654, 0.69617713149146299, \
+        0.69837624940897292, 0.70056879394324834, 0.7027547444572253, 0.70493408037590488, \
+        0.70710678118654746, 0.70927282643886558, 0.71143219574521643, 0.71358486878079352, \
+        0.71573082528381859, 0.71787004505573171, 0.72000250796138165, 0.72212819392921535, \
+        0.72424708295146689, 0.72635915508434601, 0.7284643904482252, 0.73056276922782759, \
+        0.73265427167241282, 0.73473887809596339, 0.73681656887736979, 0.73888732446061511, \
+        0.74095112535495911, 0.74300795213512172, 0.74505778544146595, 0.74710060598018013, \
+        0.74913639452345926, 0.75116513190968637, 0.75318679904361241, 0.75520137689653655, \
+        0.75720884650648446, 0.75920918897838796, 0.76120238548426178, 0.76318841726338127, \
+        0.76516726562245896, 0.7671389119358204, 0.76910333764557959, 0.77106052426181371, \
+        0.77301045336273699, 0.77495310659487382, 0.77688846567323244, 0.77881651238147587, \
+        0.78073722857209438, 0.78265059616657573, 0.78455659715557524, 0.78645521359908577, \
+        0.78834642762660623, 0.79023022143731003, 0.79210657730021239, 0.79397547755433717, \
+        0.79583690460888346, 0.79769084094339104, 0.79953726910790501, 0.80137617172314013, \
+        0.80320753148064483, 0.80503133114296366, 0.80684755354379922, 0.80865618158817498, \
+        0.81045719825259477, 0.81225058658520388, 0.8140363297059483, 0.81581441080673378, \
+        0.81758481315158371, 0.8193475200767969, 0.82110251499110465, 0.82284978137582632, \
+        0.82458930278502529, 0.82632106284566342, 0.8280450452577558, 0.82976123379452305, \
+        0.83146961230254524, 0.83317016470191319, 0.83486287498638001, 0.83654772722351189, \
+        0.83822470555483797, 0.83989379419599941, 0.84155497743689833, 0.84320823964184544, \
+        0.84485356524970701, 0.84649093877405202, 0.84812034480329712, 0.84974176800085244, \
+        0.8513551931052652, 0.85296060493036363, 0.85455798836540053, 0.85614732837519447, \
+        0.85772861000027212, 0.85930181835700836, 0.86086693863776731, 0.8624239561110405, \
+        0.8639728561215867, 0.86551362409056898, 0.86704624551569265, 0.8685707059713409, \
+        0.87008699110871135, 0.87159508665595109, 0.87309497841829009, 0.87458665227817611, \
+        0.8760700941954066, 0.87754529020726124, 0.87901222642863341, 0.88047088905216075, \
+        0.88192126434835494, 0.88336333866573158, 0.88479709843093779, 0.88622253014888064, \
+        0.88763962040285393, 0.88904835585466457, 0.89044872324475788, 0.89184070939234272, \
+        0.89322430119551532, 0.89459948563138258, 0.89596624975618511, 0.89732458070541832, \
+        0.89867446569395382, 0.90001589201616028, 0.90134884704602203, 0.90267331823725883, \
+        0.90398929312344334, 0.90529675931811882, 0.90659570451491533, 0.90788611648766615, \
+        0.90916798309052227, 0.91044129225806714, 0.91170603200542988, 0.9129621904283981, \
+        0.91420975570353069, 0.91544871608826783, 0.9166790599210427, 0.91790077562139039, \
+        0.91911385169005777, 0.92031827670911048, 0.9215140393420419, 0.92270112833387852, \
+        0.92387953251128674, 0.92504924078267758, 0.92621024213831127, 0.92736252565040111, \
+        0.92850608047321548, 0.92964089584318133, 0.93076696107898371, 0.93188426558166815, \
+        0.93299279883473885, 0.93409255040425887, 0.9351835099389475, 0.93626566717027826, \
+        0.93733901191257496, 0.93840353406310806, 0.93945922360218992, 0.9405060705932683, \
+        0.94154406518302081, 0.94257319760144687, 0.94359345816196039, 0.94460483726148026, \
+        0.94560732538052128, 0.94660091308328353, 0.94758559101774109, 0.94856134991573027, \
+        0.94952818059303667, 0.9504860739494817, 0.95143502096900834, 0.95237501271976588, \
+        0.95330604035419375, 0.95422809510910567, 0.95514116830577067, 0.95604525134999641, \
+        0.95694033573220894, 0.95782641302753291, 0.9587034748958716, 0.95957151308198452, \
+        0.96043051941556579, 0.96128048581132064, 0.96212140426904158, 0.96295326687368388, \
+        0.96377606579543984, 0.96458979328981265, 0.9653944416976894, 0.96619000344541262, \
+        0.96697647104485207, 0.96775383709347551, 0.96852209427441727, 0.96928123535654853, \
+        0.97003125319454397, 0.97077214072895035, 0.97150389098625178, 0.97222649707893627, \
+        0.97293995220556007, 0.97364424965081187, 0.97433938278557586, 0.97502534506699412, \
+        0.97570213003852857, 0.97636973133002114, 0.97702814265775439, 0.97767735782450993, \
+        0.97831737071962765, 0.9789481753190622, 0.97956976568544052, 0.98018213596811732, \
+        0.98078528040323043, 0.98137919331375456, 0.98196386910955524, 0.98253930228744124, \
+        0.98310548743121629, 0.98366241921173025, 0.98421009238692903, 0.98474850180190421, \
+        0.98527764238894122, 0.98579750916756737, 0.98630809724459867, 0.98680940181418542, \
+        0.98730141815785843, 0.98778414164457218, 0.98825756773074946, 0.98872169196032378, \
+        0.98917650996478101, 0.98962201746320078, 0.99005821026229712, 0.99048508425645698, \
+        0.99090263542778001, 0.99131085984611544, 0.99170975366909953, 0.9920993131421918, \
+        0.99247953459870997, 0.9928504144598651, 0.9932119492347945, 0.9935641355205953, \
+        0.99390697000235606, 0.9942404494531879, 0.99456457073425542, 0.99487933079480562, \
+        0.99518472667219682, 0.99548075549192694, 0.99576741446765982, 0.99604470090125197, \
+        0.996312612182778, 0.99657114579055484, 0.99682029929116567, 0.99706007033948296, \
+        0.99729045667869021, 0.99751145614030345, 0.99772306664419164, 0.997925286198596, \
+        0.99811811290014918, 0.99830154493389289, 0.99847558057329477, 0.99864021818026527, \
+        0.99879545620517241, 0.99894129318685687, 0.99907772775264536, 0.99920475861836389, \
+        0.99932238458834954, 0.99943060455546173, 0.99952941750109314, 0.99961882249517864, \
+        0.99969881869620425, 0.99976940535121528, 0.9998305817958234, 0.99988234745421256, \
+        0.9999247018391445, 0.9999576445519639, 0.99998117528260111, 0.99999529380957619, \
+        1, 0.99999529380957619, 0.99998117528260111, 0.9999576445519639, \
+        0.9999247018391445, 0.99988234745421256, 0.9998305817958234, 0.99976940535121528, \
+        0.99969881869620425, 0.99961882249517864, 0.99952941750109314, 0.99943060455546173, \
+        0.99932238458834954, 0.99920475861836389, 0.99907772775264536, 0.99894129318685687, \
+        0.99879545620517241, 0.99864021818026527, 0.99847558057329477, 0.99830154493389289, \
+        0.99811811290014918, 0.997925286198596, 0.99772306664419164, 0.99751145614030345, \
+        0.99729045667869021, 0.99706007033948296, 0.99682029929116578, 0.99657114579055484, \
+        0.996312612182778, 0.99604470090125197, 0.99576741446765982, 0.99548075549192694, \
+        0.99518472667219693, 0.99487933079480562, 0.99456457073425542, 0.9942404494531879, \
+        0.99390697000235606, 0.9935641355205953, 0.9932119492347945, 0.9928504144598651, \
+        0.99247953459870997, 0.9920993131421918, 0.99170975366909953, 0.99131085984611544, \
+        0.99090263542778001, 0.99048508425645698, 0.99005821026229712, 0.98962201746320089, \
+        0.98917650996478101, 0.98872169196032378, 0.98825756773074946, 0.98778414164457218, \
+        0.98730141815785843, 0.98680940181418553, 0.98630809724459867, 0.98579750916756748, \
+        0.98527764238894122, 0.98474850180190421, 0.98421009238692903, 0.98366241921173025, \
+        0.98310548743121629, 0.98253930228744124, 0.98196386910955524, 0.98137919331375456, \
+        0.98078528040323043, 0.98018213596811743, 0.97956976568544052, 0.9789481753190622, \
+        0.97831737071962765, 0.97767735782450993, 0.97702814265775439, 0.97636973133002114, \
+        0.97570213003852857, 0.97502534506699412, 0.97433938278557586, 0.97364424965081198, \
+        0.97293995220556018, 0.97222649707893638, 0.97150389098625178, 0.97077214072895035, \
+        0.97003125319454397, 0.96928123535654853, 0.96852209427441738, 0.96775383709347551, \
+        0.96697647104485207, 0.96619000344541262, 0.9653944416976894, 0.96458979328981276, \
+        0.96377606579543984, 0.96295326687368388, 0.96212140426904158, 0.96128048581132064, \
+        0.9604305194155659, 0.95957151308198452, 0.9587034748958716, 0.95782641302753291, \
+        0.95694033573220894, 0.95604525134999652, 0.95514116830577067, 0.95422809510910567, \
+        0.95330604035419386, 0.95237501271976588, 0.95143502096900834, 0.95048607394948181, \
+        0.94952818059303667, 0.94856134991573038, 0.9475855910177412, 0.94660091308328353, \
+        0.94560732538052139, 0.94460483726148026, 0.94359345816196039, 0.94257319760144687, \
+        0.94154406518302081, 0.9405060705932683, 0.93945922360218992, 0.93840353406310817, \
+        0.93733901191257496, 0.93626566717027826, 0.93518350993894761, 0.93409255040425898, \
+        0.93299279883473885, 0.93188426558166815, 0.93076696107898371, 0.92964089584318133, \
+        0.92850608047321559, 0.92736252565040111, 0.92621024213831138, 0.9250492407826777, \
+        0.92387953251128674, 0.92270112833387852, 0.92151403934204201, 0.92031827670911059, \
+        0.91911385169005777, 0.9179007756213905, 0.9166790599210427, 0.91544871608826783, \
+        0.91420975570353069, 0.91296219042839821, 0.91170603200542988, 0.91044129225806725, \
+        0.90916798309052249, 0.90788611648766615, 0.90659570451491533, 0.90529675931811882, \
+        0.90398929312344345, 0.90267331823725883, 0.90134884704602203, 0.90001589201616028, \
+        0.89867446569395393, 0.89732458070541832, 0.89596624975618522, 0.89459948563138281, \
+        0.89322430119551521, 0.89184070939234272, 0.89044872324475799, 0.88904835585466468, \
+        0.88763962040285393, 0.88622253014888064, 0.8847970984309379, 0.88336333866573169, \
+        0.88192126434835505, 0.88047088905216087, 0.87901222642863353, 0.87754529020726124, \
+        0.8760700941954066, 0.87458665227817622, 0.8730949784182902, 0.87159508665595098, \
+        0.87008699110871146, 0.86857070597134101, 0.86704624551569276, 0.86551362409056909, \
+        0.86397285612158681, 0.86242395611104061, 0.8608669386377672, 0.85930181835700836, \
+        0.85772861000027212, 0.85614732837519458, 0.85455798836540053, 0.85296060493036374, \
+        0.8513551931052652, 0.84974176800085266, 0.84812034480329723, 0.84649093877405213, \
+        0.84485356524970723, 0.84320823964184544, 0.84155497743689844, 0.83989379419599963, \
+        0.83822470555483819, 0.83654772722351201, 0.83486287498638012, 0.8331701647019133, \
+        0.83146961230254546, 0.82976123379452305, 0.8280450452577558, 0.82632106284566365, \
+        0.82458930278502518, 0.82284978137582632, 0.82110251499110476, 0.81934752007679712, \
+        0.81758481315158371, 0.81581441080673378, 0.81403632970594852, 0.81225058658520388, \
+        0.81045719825259477, 0.80865618158817509, 0.80684755354379945, 0.80503133114296355, \
+        0.80320753148064494, 0.80137617172314035, 0.79953726910790524, 0.79769084094339104, \
+        0.79583690460888357, 0.79397547755433728, 0.79210657730021228, 0.79023022143731003, \
+        0.78834642762660634, 0.78645521359908588, 0.78455659715557513, 0.78265059616657573, \
+        0.7807372285720946, 0.77881651238147609, 0.77688846567323244, 0.77495310659487393, \
+        0.7730104533627371, 0.77106052426181371, 0.76910333764557959, 0.76713891193582051, \
+        0.76516726562245907, 0.76318841726338127, 0.76120238548426189, 0.75920918897838818, \
+        0.75720884650648468, 0.75520137689653655, 0.75318679904361252, 0.75116513190968659, \
+        0.74913639452345926, 0.74710060598018013, 0.74505778544146606, 0.74300795213512183, \
+        0.74095112535495899, 0.73888732446061522, 0.73681656887737002, 0.73473887809596361, \
+        0.73265427167241282, 0.73056276922782759, 0.72846439044822531, 0.7263591550843459, \
+        0.72424708295146689, 0.72212819392921546, 0.72000250796138177, 0.71787004505573171, \
+        0.71573082528381871, 0.71358486878079375, 0.71143219574521666, 0.70927282643886558, \
+        0.70710678118654757, 0.7049340803759051, 0.70275474445722519, 0.70056879394324834, \
+        0.69837624940897292, 0.6961771314914631, 0.693971460889654, 0.69175925836415786, \
+        0.68954054473706705, 0.68731534089175927, 0.68508366777270036, 0.68284554638524819, \
+        0.68060099779545324, 0.67835004312986136, 0.67609270357531592, 0.67382900037875615, \
+        0.67155895484701855, 0.66928258834663601, 0.66699992230363758, 0.66471097820334502, \
+        0.66241577759017201, 0.66011434206742048, 0.65780669329707875, 0.65549285299961557, \
+        0.65317284295377664, 0.65084668499638099, 0.64851440102211255, 0.64617601298331662, \
+        0.64383154288979139, 0.64148101280858316, 0.63912444486377584, 0.63676186123628442, \
+        0.63439328416364549, 0.63201873593980906, 0.62963823891492721, 0.62725181549514408, \
+        0.62485948814238634, 0.62246127937415008, 0.62005721176328943, 0.61764730793780387, \
+        0.61523159058062693, 0.61281008242940982, 0.6103828062763097, 0.60794978496777363, \
+        0.60551104140432566, 0.60306659854034839, 0.60061647938386886, 0.59816070699634238, \
+        0.59569930449243347, 0.59323229503980002, 0.59075970185887416, 0.58828154822264533, \
+        0.58579785745643898, 0.58330865293769851, 0.58081395809576453, 0.5783137964116557, \
+        0.57580819141784545, 0.57329716669804209, 0.57078074588696726, 0.56825895267013171, \
+        0.56573181078361345, 0.56319934401383409, 0.56066157619733614, 0.55811853122055632, \
+        0.55557023301960218, 0.55301670558002758, 0.55045797293660492, 0.54789405917310041, \
+        0.54532498842204635, 0.54275078486451589, 0.54017147272989297, 0.53758707629564573, \
+        0.53499761988709715, 0.53240312787719801, 0.52980362468629483, 0.52719913478190128, \
+        0.52458968267846895, 0.5219752929371545, 0.51935599016558975, 0.51673179901764976, \
+        0.51410274419322177, 0.51146885043797052, 0.50883014254310732, 0.50618664534515523, \
+        0.50353838372571769, 0.50088538261124094, 0.49822766697278176, 0.49556526182577254, \
+        0.49289819222978415, 0.49022648328829138, 0.48755016014843588, 0.48486924800079112, \
+        0.48218377207912289, 0.47949375766015329, 0.47679923006332209, 0.47410021465055008, \
+        0.47139673682599786, 0.46868882203582785, 0.46597649576796618, 0.46325978355186032, \
+        0.46053871095824023, 0.45781330359887717, 0.45508358712634389, 0.45234958723377106, \
+        0.44961132965460687, 0.44686884016237416, 0.44412214457042931, 0.44137126873171689, \
+        0.43861623853852755, 0.43585707992225553, 0.43309381885315207, 0.43032648134008289, \
+        0.42755509343028203, 0.42477968120910886, 0.42200027079979985, 0.41921688836322424, \
+        0.41642956009763715, 0.41363831223843461, 0.41084317105790413, 0.40804416286497858, \
+        0.40524131400498992, 0.4024346508594186, 0.39962419984564707, 0.39680998741671025, \
+        0.39399204006104815, 0.39117038430225404, 0.38834504669882658, 0.38551605384391885, \
+        0.38268343236508989, 0.37984720892405138, 0.37700741021641815, 0.37416406297145804, \
+        0.37131719395183771, 0.3684668299533726, 0.3656129978047738, 0.36275572436739728, \
+        0.35989503653498833, 0.35703096123343031, 0.3541635254204904, 0.3512927560855672, \
+        0.34841868024943479, 0.34554132496398898, 0.34266071731199443, 0.33977688440682702, \
+        0.33688985339222033, 0.33399965144200938, 0.33110630575987648, 0.32820984357909272, \
+        0.32531029216226326, 0.32240767880106985, 0.3195020308160158, 0.31659337555616607, \
+        0.31368174039889141, 0.31076715274961153, 0.30784964004153503, 0.30492922973540265, \
+        0.30200594931922803, 0.29907982630804053, 0.29615088824362401, 0.29321916269425896, \
+        0.29028467725446239, 0.28734745954472962, 0.2844075372112721, 0.28146493792575789, \
+        0.27851968938505317, 0.27557181931095831, 0.27262135544994925, 0.26966832557291509, \
+        0.26671275747489848, 0.26375467897483157, 0.26079411791527585, 0.25783110216215899, \
+        0.25486565960451468, 0.25189781815421719, 0.24892760574572009, 0.24595505033579465, \
+        0.24298017990326407, 0.24000302244874178, 0.23702360599436717, 0.23404195858354351, \
+        0.23105810828067133, 0.22807208317088606, 0.22508391135979283, 0.22209362097320365, \
+        0.21910124015687005, 0.21610679707621944, 0.21311031991609142, 0.2101118368804698, \
+        0.20711137619221884, 0.20410896609281684, 0.20110463484209201, 0.19809841071795381, \
+        0.19509032201612861, 0.19208039704989247, 0.18906866414980636, 0.18605515166344691, \
+        0.1830398879551409, 0.18002290140569957, 0.17700422041214894, 0.17398387338746413, \
+        0.17096188876030122, 0.16793829497473128, 0.16491312048997014, 0.16188639378011174, \
+        0.15885814333386147, 0.15582839765426537, 0.15279718525844369, 0.14976453467732145, \
+        0.1467304744553618, 0.14369503315029464, 0.14065823933284954, 0.13762012158648604, \
+        0.13458070850712628, 0.13154002870288334, 0.12849811079379309, 0.12545498341154626, \
+        0.12241067519921635, 0.11936521481099163, 0.11631863091190471, 0.11327095217756442, \
+        0.11022220729388324, 0.10717242495680916, 0.10412163387205457, 0.10106986275482793, \
+        0.098017140329560826, 0.094963495329638908, 0.091908956497132752, 0.088853552582524753, \
+        0.085797312344440158, 0.082740264549375636, 0.079682437971430195, 0.076623861392031686, \
+        0.073564563599667732, 0.070504573389613856, 0.067443919563664176, 0.064382630929857701, \
+        0.061320736302208488, 0.058258264500435794, 0.055195244349690094, 0.052131704680283594, \
+        0.049067674327417966, 0.046003182130914706, 0.042938256934941021, 0.03987292758774013, \
+        0.036807222941358832, 0.033741171851377705, 0.030674803176636865, 0.02760814577896566, \
+        0.024541228522912326, 0.021474080275469667, 0.018406729905805101, 0.01533920628498806, \
+        0.012271538285720007, 0.0092037547820600207, 0.0061358846491547988, 0.003067956762965977 \
+    }
+
+#define FFT_TABLE_2048_REV \
+    { \
+        0, 1024, 512, 1536, 256, 1280, 768, 1792, 128, 1152, 640, 1664, 384, 1408, 896, 1920, \
+        64, 1088, 576, 1600, 320, 1344, 832, 1856, 192, 1216, 704, 1728, 448, 1472, 960, 1984, \
+        32, 1056, 544, 1568, 288, 1312, 800, 1824, 160, 1184, 672, 1696, 416, 1440, 928, 1952, \
+        96, 1120, 608, 1632, 352, 1376, 864, 1888, 224, 1248, 736, 1760, 480, 1504, 992, 2016, \
+        16, 1040, 528, 1552, 272, 1296, 784, 1808, 144, 1168, 656, 1680, 400, 1424, 912, 1936, \
+        80, 1104, 592, 1616, 336, 1360, 848, 1872, 208, 1232, 720, 1744, 464, 1488, 976, 2000, \
+        48, 1072, 560, 1584, 304, 1328, 816, 1840, 176, 1200, 688, 1712, 432, 1456, 944, 1968, \
+        112, 1136, 624, 1648, 368, 1392, 880, 1904, 240, 1264, 752, 1776, 496, 1520, 1008, 2032, \
+        8, 1032, 520, 1544, 264, 1288, 776, 1800, 136, 1160, 648, 1672, 392, 1416, 904, 1928, \
+        72, 1096, 584, 1608, 328, 1352, 840, 1864, 200, 1224, 712, 1736, 456, 1480, 968, 1992, \
+        40, 1064, 552, 1576, 296, 1320, 808, 1832, 168, 1192, 680, 1704, 424, 1448, 936, 1960, \
+        104, 1128, 616, 1640, 360, 1384, 872, 1896, 232, 1256, 744, 1768, 488, 1512, 1000, 2024, \
+        24, 1048, 536, 1560, 280, 1304, 792, 1816, 152, 1176, 664, 1688, 408, 1432, 920, 1944, \
+        88, 1112, 600, 1624, 344, 1368, 856, 1880, 216, 1240, 728, 1752, 472, 1496, 984, 2008, \
+        56, 1080, 568, 1592, 312, 1336, 824, 1848, 184, 1208, 696, 1720, 440, 1464, 952, 1976, \
+        120, 1144, 632, 1656, 376, 1400, 888, 1912, 248, 1272, 760, 1784, 504, 1528, 1016, 2040, \
+        4, 1028, 516, 1540, 260, 1284, 772, 1796, 132, 1156, 644, 1668, 388, 1412, 900, 1924, \
+        68, 1092, 580, 1604, 324, 1348, 836, 1860, 196, 1220, 708, 1732, 452, 1476, 964, 1988, \
+        36, 1060, 548, 1572, 292, 1316, 804, 1828, 164, 1188, 676, 1700, 420, 1444, 932, 1956, \
+        100, 1124, 612, 1636, 356, 1380, 868, 1892, 228, 1252, 740, 1764, 484, 1508, 996, 2020, \
+        20, 1044, 532, 1556, 276, 1300, 788, 1812, 148, 1172, 660, 1684, 404, 1428, 916, 1940, \
+        84, 1108, 596, 1620, 340, 1364, 852, 1876, 212, 1236, 724, 1748, 468, 1492, 980, 2004, \
+        52, 1076, 564, 1588, 308, 1332, 820, 1844, 180, 1204, 692, 1716, 436, 1460, 948, 1972, \
+        116, 1140, 628, 1652, 372, 1396, 884, 1908, 244, 1268, 756, 1780, 500, 1524, 1012, 2036, \
+        12, 1036, 524, 1548, 268, 1292, 780, 1804, 140, 1164, 652, 1676, 396, 1420, 908, 1932, \
+        76, 1100, 588, 1612, 332, 1356, 844, 1868, 204, 1228, 716, 1740, 460, 1484, 972, 1996, \
+        44, 1068, 556, 1580, 300, 1324, 812, 1836, 172, 1196, 684, 1708, 428, 1452, 940, 1964, \
+        108, 1132, 620, 1644, 364, 1388, 876, 1900, 236, 1260, 748, 1772, 492, 1516, 1004, 2028, \
+        28, 1052, 540, 1564, 284, 1308, 796, 1820, 156, 1180, 668, 1692, 412, 1436, 924, 1948, \
+        92, 1116, 604, 1628, 348, 1372, 860, 1884, 220, 1244, 732, 1756, 476, 1500, 988, 2012, \
+        60, 1084, 572, 1596, 316, 1340, 828, 1852, 188, 1212, 700, 1724, 444, 1468, 956, 1980, \
+        124, 1148, 636, 1660, 380, 1404, 892, 1916, 252, 1276, 764, 1788, 508, 1532, 1020, 2044, \
+        2, 1026, 514, 1538, 258, 1282, 770, 1794, 130, 1154, 642, 1666, 386, 1410, 898, 1922, \
+        66, 1090, 578, 1602, 322, 1346, 834, 1858, 194, 1218, 706, 1730, 450, 1474, 962, 1986, \
+        34, 1058, 546, 1570, 290, 1314, 802, 1826, 162, 1186, 674, 1698, 418, 1442, 930, 1954, \
+        98, 1122, 610, 1634, 354, 1378, 866, 1890, 226, 1250, 738, 1762, 482, 1506, 994, 2018, \
+        18, 1042, 530, 1554, 274, 1298, 786, 1810, 146, 1170, 658, 1682, 402, 1426, 914, 1938, \
+        82, 1106, 594, 1618, 338, 1362, 850, 1874, 210, 1234, 722, 1746, 466, 1490, 978, 2002, \
+        50, 1074, 562, 1586, 306, 1330, 818, 1842, 178, 1202, 690, 1714, 434, 1458, 946, 1970, \
+        114, 1138, 626, 1650, 370, 1394, 882, 1906, 242, 1266, 754, 1778, 498, 1522, 1010, 2034, \
+        10, 1034, 522, 1546, 266, 1290, 778, 1802, 138, 1162, 650, 1674, 394, 1418, 906, 1930, \
+        74, 1098, 586, 1610, 330, 1354, 842, 1866, 202, 1226, 714, 1738, 458, 1482, 970, 1994, \
+        42, 1066, 554, 1578, 298, 1322, 810, 1834, 170, 1194, 682, 1706, 426, 1450, 938, 1962, \
+        106, 1130, 618, 1642, 362, 1386, 874, 1898, 234, 1258, 746, 1770, 490, 1514, 1002, 2026, \
+        26, 1050, 538, 1562, 282, 1306, 794, 1818, 154, 1178, 666, 1690, 410, 1434, 922, 1946, \
+        90, 1114, 602, 1626, 346, 1370, 858, 1882, 218, 1242, 730, 1754, 474, 1498, 986, 2010, \
+        58, 1082, 570, 1594, 314, 1338, 826, 1850, 186, 1210, 698, 1722, 442, 1466, 954, 1978, \
+        122, 1146, 634, 1658, 378, 1402, 890, 1914, 250, 1274, 762, 1786, 506, 1530, 1018, 2042, \
+        6, 1030, 518, 1542, 262, 1286, 774, 1798, 134, 1158, 646, 1670, 390, 1414, 902, 1926, \
+        70, 1094, 582, 1606, 326, 1350, 838, 1862, 198, 1222, 710, 1734, 454, 1478, 966, 1990, \
+        38, 1062, 550, 1574, 294, 1318, 806, 1830, 166, 1190, 678, 1702, 422, 1446, 934, 1958, \
+        102, 1126, 614, 1638, 358, 1382, 870, 1894, 230, 1254, 742, 1766, 486, 1510, 998, 2022, \
+        22, 1046, 534, 1558, 278, 1302, 790, 1814, 150, 1174, 662, 1686, 406, 1430, 918, 1942, \
+        86, 1110, 598, 1622, 342, 1366, 854, 1878, 214, 1238, 726, 1750, 470, 1494, 982, 2006, \
+        54, 1078, 566, 1590, 310, 1334, 822, 1846, 182, 1206, 694, 1718, 438, 1462, 950, 1974, \
+        118, 1142, 630, 1654, 374, 1398, 886, 1910, 246, 1270, 758, 1782, 502, 1526, 1014, 2038, \
+        14, 1038, 526, 1550, 270, 1294, 782, 1806, 142, 1166, 654, 1678, 398, 1422, 910, 1934, \
+        78, 1102, 590, 1614, 334, 1358, 846, 1870, 206, 1230, 718, 1742, 462, 1486, 974, 1998, \
+        46, 1070, 558, 1582, 302, 1326, 814, 1838, 174, 1198, 686, 1710, 430, 1454, 942, 1966, \
+        110, 1134, 622, 1646, 366, 1390, 878, 1902, 238, 1262, 750, 1774, 494, 1518, 1006, 2030, \
+        30, 1054, 542, 1566, 286, 1310, 798, 1822, 158, 1182, 670, 1694, 414, 1438, 926, 1950, \
+        94, 1118, 606, 1630, 350, 1374, 862, 1886, 222, 1246, 734, 1758, 478, 1502, 990, 2014, \
+        62, 1086, 574, 1598, 318, 1342, 830, 1854, 190, 1214, 702, 1726, 446, 1470, 958, 1982, \
+        126, 1150, 638, 1662, 382, 1406, 894, 1918, 254, 1278, 766, 1790, 510, 1534, 1022, 2046, \
+        1, 1025, 513, 1537, 257, 1281, 769, 1793, 129, 1153, 641, 1665, 385, 1409, 897, 1921, \
+        65, 1089, 577, 1601, 321, 1345, 833, 1857, 193, 1217, 705, 1729, 449, 1473, 961, 1985, \
+        33, 1057, 545, 1569, 289, 1313, 801, 1825, 161, 1185, 673, 1697, 417, 1441, 929, 1953, \
+        97, 1121, 609, 1633, 353, 1377, 865, 1889, 225, 1249, 737, 1761, 481, 1505, 993, 2017, \
+        17, 1041, 529, 1553, 273, 1297, 785, 1809, 145, 1169, 657, 1681, 401, 1425, 913, 1937, \
+        81, 1105, 593, 1617, 337, 1361, 849, 1873, 209, 1233, 721, 1745, 465, 1489, 977, 2001, \
+        49, 1073, 561, 1585, 305, 1329, 817, 1841, 177, 1201, 689, 1713, 433, 1457, 945, 1969, \
+        113, 1137, 625, 1649, 369, 1393, 881, 1905, 241, 1265, 753, 1777, 497, 1521, 1009, 2033, \
+        9, 1033, 521, 1545, 265, 1289, 777, 1801, 137, 1161, 649, 1673, 393, 1417, 905, 1929, \
+        73, 1097, 585, 1609, 329, 1353, 841, 1865, 201, 1225, 713, 1737, 457, 1481, 969, 1993, \
+        41, 1065, 553, 1577, 297, 1321, 809, 1833, 169, 1193, 681, 1705, 425, 1449, 937, 1961, \
+        105, 1129, 617, 1641, 361, 1385, 873, 1897, 233, 1257, 745, 1769, 489, 1513, 1001, 2025, \
+        25, 1049, 537, 1561, 281, 1305, 793, 1817, 153, 1177, 665, 1689, 409, 1433, 921, 1945, \
+        89, 1113, 601, 1625, 345, 1369, 857, 1881, 217, 1241, 729, 1753, 473, 1497, 985, 2009, \
+        57, 1081, 569, 1593, 313, 1337, 825, 1849, 185, 1209, 697, 1721, 441, 1465, 953, 1977, \
+        121, 1145, 633, 1657, 377, 1401, 889, 1913, 249, 1273, 761, 1785, 505, 1529, 1017, 2041, \
+        5, 1029, 517, 1541, 261, 1285, 773, 1797, 133, 1157, 645, 1669, 389, 1413, 901, 1925, \
+        69, 1093, 581, 1605, 325, 1349, 837, 1861, 197, 1221, 709, 1733, 453, 1477, 965, 1989, \
+        37, 1061, 549, 1573, 293, 1317, 805, 1829, 165, 1189, 677, 1701, 421, 1445, 933, 1957, \
+        101, 1125, 613, 1637, 357, 1381, 869, 1893, 229, 1253, 741, 1765, 485, 1509, 997, 2021, \
+        21, 1045, 533, 1557, 277, 1301, 789, 1813, 149, 1173, 661, 1685, 405, 1429, 917, 1941, \
+        85, 1109, 597, 1621, 341, 1365, 853, 1877, 213, 1237, 725, 1749, 469, 1493, 981, 2005, \
+        53, 1077, 565, 1589, 309, 1333, 821, 1845, 181, 1205, 693, 1717, 437, 1461, 949, 1973, \
+        117, 1141, 629, 1653, 373, 1397, 885, 1909, 245, 1269, 757, 1781, 501, 1525, 1013, 2037, \
+        13, 1037, 525, 1549, 269, 1293, 781, 1805, 141, 1165, 653, 1677, 397, 1421, 909, 1933, \
+        77, 1101, 589, 1613, 333, 1357, 845, 1869, 205, 1229, 717, 1741, 461, 1485, 973, 1997, \
+        45, 1069, 557, 1581, 301, 1325, 813, 1837, 173, 1197, 685, 1709, 429, 1453, 941, 1965, \
+        109, 1133, 621, 1645, 365, 1389, 877, 1901, 237, 1261, 749, 1773, 493, 1517, 1005, 2029, \
+        29, 1053, 541, 1565, 285, 1309, 797, 1821, 157, 1181, 669, 1693, 413, 1437, 925, 1949, \
+        93, 1117, 605, 1629, 349, 1373, 861, 1885, 221, 1245, 733, 1757, 477, 1501, 989, 2013, \
+        61, 1085, 573, 1597, 317, 1341, 829, 1853, 189, 1213, 701, 1725, 445, 1469, 957, 1981, \
+        125, 1149, 637, 1661, 381, 1405, 893, 1917, 253, 1277, 765, 1789, 509, 1533, 1021, 2045, \
+        3, 1027, 515, 1539, 259, 1283, 771, 1795, 131, 1155, 643, 1667, 387, 1411, 899, 1923, \
+        67, 1091, 579, 1603, 323, 1347, 835, 1859, 195, 1219, 707, 1731, 451, 1475, 963, 1987, \
+        35, 1059, 547, 1571, 291, 1315, 803, 1827, 163, 1187, 675, 1699, 419, 1443, 931, 1955, \
+        99, 1123, 611, 1635, 355, 1379, 867, 1891, 227, 1251, 739, 1763, 483, 1507, 995, 2019, \
+        19, 1043, 531, 1555, 275, 1299, 787, 1811, 147, 1171, 659, 1683, 403, 1427, 915, 1939, \
+        83, 1107, 595, 1619, 339, 1363, 851, 1875, 211, 1235, 723, 1747, 467, 1491, 979, 2003, \
+        51, 1075, 563, 1587, 307, 1331, 819, 1843, 179, 1203, 691, 1715, 435, 1459, 947, 1971, \
+        115, 1139, 627, 1651, 371, 1395, 883, 1907, 243, 1267, 755, 1779, 499, 1523, 1011, 2035, \
+        11, 1035, 523, 1547, 267, 1291, 779, 1803, 139, 1163, 651, 1675, 395, 1419, 907, 1931, \
+        75, 1099, 587, 1611, 331, 1355, 843, 1867, 203, 1227, 715, 1739, 459, 1483, 971, 1995, \
+        43, 1067, 555, 1579, 299, 1323, 811, 1835, 171, 1195, 683, 1707, 427, 1451, 939, 1963, \
+        107, 1131, 619, 1643, 363, 1387, 875, 1899, 235, 1259, 747, 1771, 491, 1515, 1003, 2027, \
+        27, 1051, 539, 1563, 283, 1307, 795, 1819, 155, 1179, 667, 1691, 411, 1435, 923, 1947, \
+        91, 1115, 603, 1627, 347, 1371, 859, 1883, 219, 1243, 731, 1755, 475, 1499, 987, 2011, \
+        59, 1083, 571, 1595, 315, 1339, 827, 1851, 187, 1211, 699, 1723, 443, 1467, 955, 1979, \
+        123, 1147, 635, 1659, 379, 1403, 891, 1915, 251, 1275, 763, 1787, 507, 1531, 1019, 2043, \
+        7, 1031, 519, 1543, 263, 1287, 775, 1799, 135, 1159, 647, 1671, 391, 1415, 903, 1927, \
+        71, 1095, 583, 1607, 327, 1351, 839, 1863, 199, 1223, 711, 1735, 455, 1479, 967, 1991, \
+        39, 1063, 551, 1575, 295, 1319, 807, 1831, 167, 1191, 679, 1703, 423, 1447, 935, 1959, \
+        103, 1127, 615, 1639, 359, 1383, 871, 1895, 231, 1255, 743, 1767, 487, 1511, 999, 2023, \
+        23, 1047, 535, 1559, 279, 1303, 791, 1815, 151, 1175, 663, 1687, 407, 1431, 919, 1943, \
+        87, 1111, 599, 1623, 343, 1367, 855, 1879, 215, 1239, 727, 1751, 471, 1495, 983, 2007, \
+        55, 1079, 567, 1591, 311, 1335, 823, 1847, 183, 1207, 695, 1719, 439, 1463, 951, 1975, \
+        119, 1143, 631, 1655, 375, 1399, 887, 1911, 247, 1271, 759, 1783, 503, 1527, 1015, 2039, \
+        15, 1039, 527, 1551, 271, 1295, 783, 1807, 143, 1167, 655, 1679, 399, 1423, 911, 1935, \
+        79, 1103, 591, 1615, 335, 1359, 847, 1871, 207, 1231, 719, 1743, 463, 1487, 975, 1999, \
+        47, 1071, 559, 1583, 303, 1327, 815, 1839, 175, 1199, 687, 1711, 431, 1455, 943, 1967, \
+        111, 1135, 623, 1647, 367, 1391, 879, 1903, 239, 1263, 751, 1775, 495, 1519, 1007, 2031, \
+        31, 1055, 543, 1567, 287, 1311, 799, 1823, 159, 1183, 671, 1695, 415, 1439, 927, 1951, \
+        95, 1119, 607, 1631, 351, 1375, 863, 1887, 223, 1247, 735, 1759, 479, 1503, 991, 2015, \
+        63, 1087, 575, 1599, 319, 1343, 831, 1855, 191, 1215, 703, 1727, 447, 1471, 959, 1983, \
+        127, 1151, 639, 1663, 383, 1407, 895, 1919, 255, 1279, 767, 1791, 511, 1535, 1023, 2047 \
+    }
+
+#define FFT_TABLE_2048_HAMMING \
+    { \
+        0.080000000000000016, 0.080002166963251742, 0.080008667832590641, 0.080019502546768262, \
+        0.080034671003704538, 0.08005417306048862, 0.080078008533380318, 0.080106177197811879, \
+        0.080138678788389928, 0.080175512998898191, 0.080216679482300213, 0.080262177850742689, \
+        0.080312007675559238, 0.08036616848727407, 0.08042465977560681, 0.080487480989477278, \
+        0.080554631537010313, 0.080626110785541716, 0.080701918061624023, 0.080782052651033109, \
+        0.08086651379877452, 0.080955300709090794, 0.081048412545469017, 0.081145848430648648, \
+        0.081247607446629844, 0.081353688634681842, 0.081464090995352345, 0.081578813488476842, \
+        0.081697855033188105, 0.081821214507926898, 0.081948890750452086, 0.082080882557851842, \
+        0.082217188686554865, 0.082357807852342146, 0.082502738730359015, 0.082651979955127852, \
+        0.082805530120560411, 0.082963387779971753, 0.083125551446093349, 0.083292019591087452, \
+        0.083462790646561091, 0.083637863003581336, 0.083817235012690006, 0.084000904983919433, \
+        0.084188871186808567, 0.084381131850418789, 0.084577685163351013, 0.084778529273762671, \
+        0.08498366228938492, 0.08519308227754091, 0.085406787265163542, 0.085624775238814232, \
+        0.085847044144702123, 0.086073591888703005, 0.086304416336379364, 0.086539515313000359, \
+        0.086778886603562311, 0.08702252795280957, 0.08727043706525589, 0.087522611605205913, \
+        0.087779049196777093, 0.088039747423922343, 0.088304703830452635, 0.088573915920060253, \
+        0.088847381156342109, 0.089125096962823613, 0.089407060722983434, 0.089693269780277585, \
+        0.089983721438164632, 0.090278412960131393, 0.090577341569718195, 0.090880504450545407, \
+        0.091187898746339979, 0.091499521560962083, 0.091815369958432702, 0.092135440962961002, \
+        0.092459731558972691, 0.092788238691138225, 0.093120959264401448, 0.093457890144009181, \
+        0.09379902815554042, 0.094144370084936257, 0.094493912678530356, 0.094847652643079372, \
+        0.095205586645794205, 0.09556771131437114, 0.095934023237024046, 0.096304518962516017, \
+        0.09667919500019212, 0.097058047820012372, 0.09744107385258477, 0.097828269489199371, \
+        0.098219631081861547, 0.098615154943327121, 0.099014837347136564, 0.099418674527650464, \
+        0.099826662680084721, 0.10023879796054663, 0.10065507648607086, 0.10107549433465635, \
+        0.1015000475453029, 0.10192873211804881, 0.10236154401400827, 0.10279847915540979, \
+        0.10323953342563413, 0.10368470266925361, 0.10413398269207069, 0.10458736926115819, \
+        0.10504485810489839, 0.10550644491302397, 0.10597212533665817, 0.10644189498835588, \
+        0.10691574944214505, 0.10739368423356838, 0.10787569485972531, 0.10836177677931447, \
+        0.10885192541267641, 0.10934613614183697, 0.10984440431055048, 0.11034672522434386, \
+        0.11085309415056083, 0.1113635063184063, 0.11187795691899161, 0.1123964411053795, \
+        0.11291895399263008, 0.1134454906578467, 0.11397604614022255, 0.11451061544108687, \
+        0.1150491935239526, 0.11559177531456366, 0.11613835570094261, 0.11668892953343896, \
+        0.11724349162477765, 0.11780203675010797, 0.11836455964705267, 0.11893105501575763, \
+        0.11950151751894184, 0.12007594178194747, 0.12065432239279078, 0.12123665390221294, \
+        0.12182293082373141, 0.12241314763369171, 0.12300729877131927, 0.12360537863877208, \
+        0.12420738160119305, 0.12481330198676366, 0.12542313408675676, 0.12603687215559101, \
+        0.12665451041088438, 0.12727604303350903, 0.12790146416764603, 0.12853076792084056, \
+        0.12916394836405737, 0.12980099953173674, 0.13044191542185041, 0.13108668999595852, \
+        0.13173531717926618, 0.13238779086068109, 0.13304410489287055, 0.13370425309231981, \
+        0.13436822923939029, 0.13503602707837803, 0.1357076403175726, 0.13638306262931665, \
+        0.13706228765006534, 0.13774530898044607, 0.13843212018531936, 0.13912271479383875, \
+        0.13981708629951245, 0.14051522816026418, 0.14121713379849504, 0.14192279660114537, \
+        0.142632209919757, 0.14334536707053608, 0.14406226133441596, 0.14478288595712041, \
+        0.14550723414922734, 0.14623529908623284, 0.1469670739086153, 0.14770255172190017, \
+        0.14844172559672481, 0.14918458856890393, 0.14993113363949512, 0.15068135377486475, \
+        0.15143524190675428, 0.15219279093234678, 0.15295399371433416, 0.15371884308098382, \
+        0.15448733182620683, 0.15525945270962555, 0.15603519845664171, 0.15681456175850522, \
+        0.1575975352723829, 0.15838411162142763, 0.15917428339484802, 0.15996804314797786, \
+        0.16076538340234681, 0.16156629664575012, 0.16237077533232042, 0.16317881188259781, \
+        0.16399039868360171, 0.16480552808890275, 0.16562419241869458, 0.16644638395986616, \
+        0.16727209496607481, 0.16810131765781861, 0.16893404422251018, 0.16977026681455015, \
+        0.17060997755540103, 0.17145316853366144, 0.17229983180514058, 0.17314995939293332, \
+        0.17400354328749507, 0.17486057544671751, 0.17572104779600417, 0.17658495222834641, \
+        0.17745228060440016, 0.17832302475256218, 0.17919717646904748, 0.18007472751796638, \
+        0.18095566963140186, 0.18183999450948796, 0.1827276938204877, 0.18361875920087145, \
+        0.18451318225539626, 0.18541095455718404, 0.18631206764780206, 0.18721651303734166, \
+        0.18812428220449895, 0.18903536659665465, 0.18994975762995486, 0.19086744668939187, \
+        0.19178842512888533, 0.1927126842713639, 0.19364021540884668, 0.19457100980252545, \
+        0.19550505868284701, 0.19644235324959564, 0.19738288467197623, 0.19832664408869738, \
+        0.19927362260805476, 0.20022381130801525, 0.20117720123630045, 0.20213378341047156, \
+        0.20309354881801378, 0.20405648841642116, 0.20502259313328175, 0.20599185386636326, \
+        0.20696426148369895, 0.20793980682367325, 0.20891848069510816, 0.20990027387735044, \
+        0.21088517712035743, 0.21187318114478509, 0.2128642766420753, 0.21385845427454298, \
+        0.21485570467546483, 0.21585601844916696, 0.21685938617111372, 0.21786579838799675, \
+        0.21887524561782312, 0.21988771835000598, 0.22090320704545297, 0.22192170213665668, \
+        0.22294319402778501, 0.22396767309477089, 0.22499512968540358, 0.2260255541194191, \
+        0.22705893668859217, 0.22809526765682658, 0.22913453726024813, 0.23017673570729574, \
+        0.23122185317881389, 0.23226987982814556, 0.23332080578122433, 0.23437462113666813, \
+        0.23543131596587186, 0.23649088031310128, 0.23755330419558696, 0.23861857760361777, \
+        0.23968669050063601, 0.24075763282333112, 0.24183139448173496, 0.24290796535931702, \
+        0.2439873353130792, 0.24506949417365187, 0.24615443174538959, 0.2472421378064667, \
+        0.2483326021089744, 0.24942581437901662, 0.25052176431680723, 0.251620441596767, \
+        0.25272183586762065, 0.25382593675249476, 0.25493273384901521, 0.25604221672940519, \
+        0.25715437494058385, 0.25826919800426429, 0.25938667541705257, 0.26050679665054649, \
+        0.26162955115143505, 0.26275492834159758, 0.26388291761820359, 0.2650135083538126, \
+        0.26614668989647433, 0.26728245156982888, 0.26842078267320751, 0.26956167248173346, \
+        0.2707051102464228, 0.27185108519428586, 0.27299958652842882, 0.27415060342815523, \
+        0.27530412504906798, 0.27646014052317153, 0.27761863895897443, 0.27877960944159175, \
+        0.27994304103284801, 0.28110892277137989, 0.28227724367274037, 0.28344799272950116, \
+        0.28462115891135725, 0.2857967311652303, 0.28697469841537299, 0.28815504956347354, \
+        0.28933777348875978, 0.29052285904810443, 0.29171029507612989, 0.29290007038531357, \
+        0.29409217376609259, 0.2952865939869706, 0.29648331979462256, 0.29768233991400156, \
+        0.29888364304844428, 0.30008721787977766, 0.3012930530684263, 0.3025011372535179, \
+        0.30371145905299191, 0.30492400706370504, 0.30613876986154021, 0.30735573600151311, \
+        0.30857489401788091, 0.30979623242424947, 0.31101973971368224, 0.31224540435880799, \
+        0.31347321481193008, 0.31470315950513494, 0.31593522685040099, 0.3171694052397081, \
+        0.31840568304514638, 0.31964404861902662, 0.32088449029398902, 0.32212699638311426, \
+        0.32337155518003241, 0.32461815495903401, 0.32586678397518043, 0.32711743046441405, \
+        0.32837008264367001, 0.32962472871098636, 0.33088135684561548, 0.33213995520813561, \
+        0.33340051194056264, 0.33466301516646113, 0.33592745299105697, 0.33719381350134858, \
+        0.33846208476621992, 0.33973225483655284, 0.34100431174533896, 0.34227824350779357, \
+        0.34355403812146706, 0.34483168356635951, 0.3461111678050327, 0.34739247878272467, \
+        0.3486756044274622, 0.34996053265017518, 0.35124725134481044, 0.35253574838844559, \
+        0.3538260116414037, 0.35511802894736694, 0.35641178813349184, 0.35770727701052346, \
+        0.35900448337291069, 0.36030339499892067, 0.36160399965075474, 0.36290628507466249, \
+        0.36421023900105892, 0.36551584914463842, 0.3668231032044913, 0.36813198886422005, \
+        0.36944249379205418, 0.37075460564096774, 0.37206831204879465, 0.37338360063834602, \
+        0.3747004590175258, 0.3760188747794484, 0.37733883550255487, 0.3786603287507308, \
+        0.37998334207342255, 0.38130786300575514, 0.38263387906864943, 0.38396137776893979, \
+        0.38529034659949213, 0.38662077303932085, 0.38795264455370809, 0.3892859485943202, \
+        0.39062067259932765, 0.39195680399352223, 0.39329433018843601, 0.39463323858245991, \
+        0.39597351656096191, 0.397315151496407, 0.39865813074847495, 0.40000244166418042, \
+        0.40134807157799124, 0.40269500781194845, 0.40404323767578532, 0.40539274846704743, \
+        0.40674352747121167, 0.40809556196180641, 0.40944883920053143, 0.41080334643737776, \
+        0.41215907091074822, 0.4135159998475767, 0.41487412046345007, 0.41623341996272673, \
+        0.41759388553865878, 0.41895550437351176, 0.42031826363868585, 0.42168215049483654, \
+        0.42304715209199528, 0.42441325556969151, 0.42578044805707271, 0.42714871667302656, \
+        0.42851804852630165, 0.42988843071562921, 0.4312598503298446, 0.43263229444800932, \
+        0.43400575013953197, 0.4353802044642911, 0.43675564447275594, 0.4381320572061092, \
+        0.43950942969636936, 0.44088774896651201, 0.44226700203059299, 0.44364717589386987, \
+        0.44502825755292519, 0.44641023399578839, 0.44779309220205898, 0.44917681914302843, \
+        0.45056140178180365, 0.45194682707342942, 0.45333308196501132, 0.45472015339583899, \
+        0.45610802829750891, 0.45749669359404743, 0.45888613620203428, 0.46027634303072579, \
+        0.46166730098217784, 0.46305899695136998, 0.46445141782632782, 0.46584455048824791, \
+        0.4672383818116202, 0.46863289866435209, 0.47002808790789286, 0.4714239363973558, \
+        0.47282043098164395, 0.47421755850357261, 0.475615305799994, 0.47701365970192117, \
+        0.47841260703465166, 0.47981213461789224, 0.48121222926588281, 0.48261287778752043, \
+        0.48401406698648397, 0.48541578366135818, 0.48681801460575813, 0.48822074660845377, \
+        0.4896239664534941, 0.49102766092033229, 0.49243181678394915, 0.49383642081497903, \
+        0.49524145977983347, 0.49664692044082648, 0.498052789556299, 0.49945905388074319, \
+        0.50086570016492848, 0.50227271515602512, 0.50368008559772992, 0.50508779823039029, \
+        0.50649583979113022, 0.50790419701397416, 0.50931285662997294, 0.51072180536732825, \
+        0.51213102995151771, 0.51354051710541992, 0.51495025354943991, 0.51636022600163389, \
+        0.51777042117783456, 0.51918082579177627, 0.52059142655521973, 0.52200221017807813, \
+        0.52341316336854149, 0.52482427283320254, 0.52623552527718143, 0.52764690740425102, \
+        0.52905840591696296, 0.53047000751677165, 0.53188169890416082, 0.5332934667787681, \
+        0.53470529783951026, 0.53611717878470888, 0.53752909631221579, 0.53894103711953778, \
+        0.54035298790396291, 0.54176493536268422, 0.54317686619292693, 0.54458876709207282, \
+        0.54600062475778532, 0.54741242588813555, 0.54882415718172706, 0.55023580533782135, \
+        0.55164735705646339, 0.55305879903860677, 0.55447011798623869, 0.55588130060250562, \
+        0.55729233359183883, 0.55870320366007864, 0.56011389751460117, 0.56152440186444208, \
+        0.56293470342042273, 0.56434478889527495, 0.56575464500376693, 0.56716425846282703, \
+        0.56857361599167067, 0.56998270431192366, 0.57139151014774869, 0.57280002022596976, \
+        0.57420822127619742, 0.57561610003095376, 0.57702364322579724, 0.57843083759944813, \
+        0.57983766989391272, 0.58124412685460936, 0.58265019523049166, 0.58405586177417523, \
+        0.58546111324206107, 0.58686593639446072, 0.58827031799572183, 0.58967424481435116, \
+        0.59107770362314127, 0.5924806811992932, 0.5938831643245428, 0.59528513978528375, \
+        0.59668659437269311, 0.59808751488285505, 0.59948788811688603, 0.60088770088105847, \
+        0.60228693998692528, 0.60368559225144425, 0.60508364449710195, 0.60648108355203845, \
+        0.60787789625017041, 0.60927406943131657, 0.61066958994132026, 0.61206444463217435, \
+        0.61345862036214449, 0.61485210399589374, 0.61624488240460529, 0.61763694246610679, \
+        0.61902827106499392, 0.62041885509275385, 0.62180868144788892, 0.62319773703603976, \
+        0.62458600877010906, 0.62597348357038418, 0.62736014836466159, 0.62874599008836851, \
+        0.63013099568468756, 0.63151515210467835, 0.63289844630740122, 0.63428086526004035, \
+        0.63566239593802565, 0.63704302532515644, 0.63842274041372316, 0.63980152820463077, \
+        0.64117937570752048, 0.6425562699408931, 0.64393219793222989, 0.6453071467181164, \
+        0.64668110334436346, 0.64805405486612955, 0.6494259883480431, 0.65079689086432391, \
+        0.65216674949890518, 0.65353555134555485, 0.65490328350799809, 0.65626993310003734, \
+        0.65763548724567555, 0.65899993307923543, 0.66036325774548277, 0.66172544839974567, \
+        0.66308649220803684, 0.66444637634717429, 0.66580508800490135, 0.66716261438000857, \
+        0.66851894268245327, 0.66987406013348094, 0.67122795396574486, 0.67258061142342696, \
+        0.67393201976235739, 0.67528216625013548, 0.67663103816624892, 0.67797862280219401, \
+        0.6793249074615948, 0.68066987946032387, 0.68201352612662081, 0.68335583480121165, \
+        0.68469679283742901, 0.68603638760133012, 0.68737460647181681, 0.68871143684075364, \
+        0.69004686611308708, 0.69138088170696466, 0.69271347105385217, 0.69404462159865365, \
+        0.69537432079982842, 0.69670255612951004, 0.69802931507362398, 0.69935458513200544, \
+        0.7006783538185174, 0.7020006086611682, 0.703321337202229, 0.70464052699835089, \
+        0.70595816562068259, 0.70727424065498723, 0.7085887397017594, 0.70990165037634201, \
+        0.71121296030904324, 0.71252265714525209, 0.71383072854555618, 0.71513716218585666, \
+        0.71644194575748577, 0.71774506696732143, 0.7190465135379035, 0.72034627320754996, \
+        0.72164433373047199, 0.7229406828768894, 0.72423530843314576, 0.72552819820182368, \
+        0.72681934000185955, 0.72810872166865859, 0.72939633105420887, 0.73068215602719677, \
+        0.73196618447311967, 0.7332484042944023, 0.73452880341050863, 0.73580736975805672, \
+        0.73708409129093211, 0.73835895598040191, 0.73963195181522701, 0.7409030668017762, \
+        0.74217228896413889, 0.74343960634423778, 0.74470500700194142, 0.74596847901517704, \
+        0.74723001048004334, 0.74848958951092071, 0.74974720424058583, 0.75100284282032159, \
+        0.75225649342002976, 0.75350814422834134, 0.75475778345272904, 0.75600539931961785, \
+        0.75725098007449587, 0.75849451398202505, 0.75973598932615216, 0.76097539441021866, \
+        0.76221271755707098, 0.76344794710917108, 0.76468107142870578, 0.76591207889769652, \
+        0.76714095791810843, 0.7683676969119605, 0.76959228432143401, 0.77081470860898149, \
+        0.77203495825743551, 0.77325302177011701, 0.77446888767094402, 0.77568254450453944, \
+        0.77689398083633932, 0.77810318525269984, 0.77931014636100582, 0.78051485278977728, \
+        0.78171729318877703, 0.78291745622911746, 0.78411533060336769, 0.78531090502565837, \
+        0.7865041682317907, 0.78769510897934081, 0.78888371604776553, 0.79006997823850933, \
+        0.7912538843751088, 0.79243542330329841, 0.79361458389111517, 0.79479135502900422, \
+        0.79596572562992285, 0.79713768462944534, 0.79830722098586659, 0.79947432368030746, \
+        0.80063898171681713, 0.80180118412247747, 0.80296091994750618, 0.80411817826536025, \
+        0.8052729481728389, 0.80642521879018525, 0.80757497926119082, 0.80872221875329586, \
+        0.80986692645769209, 0.81100909158942525, 0.81214870338749612, 0.81328575111496182, \
+        0.81442022405903658, 0.81555211153119367, 0.81668140286726532, 0.81780808742754418, \
+        0.81893215459688151, 0.82005359378478948, 0.82117239442554002, 0.82228854597826384, \
+        0.8234020379270508, 0.82451285978104782, 0.82562100107455905, 0.82672645136714296, \
+        0.82782920024371198, 0.82892923731463042, 0.83002655221581145, 0.83112113460881543, \
+        0.83221297418094775, 0.83330206064535539, 0.83438838374112334, 0.83547193323337265, \
+        0.83655269891335571, 0.83763067059855312, 0.83870583813276878, 0.83977819138622678, \
+        0.84084772025566545, 0.84191441466443417, 0.84297826456258629, 0.84403925992697615, \
+        0.84509739076135149, 0.84615264709644855, 0.84720501899008616, 0.84825449652725915, \
+        0.84930106982023146, 0.8503447290086299, 0.85138546425953632, 0.85242326576758121, \
+        0.85345812375503538, 0.8544900284719017, 0.85551897019600853, 0.85654493923309971, \
+        0.85756792591692621, 0.85858792060933808, 0.85960491370037417, 0.86061889560835381, \
+        0.86162985677996562, 0.86263778769035859, 0.86364267884323176, 0.86464452077092369, \
+        0.86564330403450074, 0.86663901922384734, 0.86763165695775402, 0.86862120788400521, \
+        0.86960766267946843, 0.87059101205018175, 0.87157124673144093, 0.87254835748788695, \
+        0.87352233511359356, 0.87449317043215302, 0.87546085429676368, 0.87642537759031491, \
+        0.87738673122547395, 0.87834490614477145, 0.87929989332068625, 0.88025168375573093, \
+        0.8812002684825363, 0.88214563856393613, 0.88308778509305119, 0.88402669919337318, \
+        0.88496237201884831, 0.88589479475396105, 0.88682395861381624, 0.88774985484422309, \
+        0.88867247472177691, 0.88959180955394124, 0.89050785067912952, 0.89142058946678826, \
+        0.89233001731747619, 0.89323612566294674, 0.89413890596622825, 0.89503834972170426, \
+        0.89593444845519443, 0.89682719372403308, 0.89771657711714992, 0.8986025902551491, \
+        0.89948522479038684, 0.9003644724070522, 0.90124032482124394, 0.90211277378104926, \
+        0.90298181106662068, 0.90384742849025468, 0.90470961789646787, 0.90556837116207456, \
+        0.9064236801962624, 0.90727553694066987, 0.90812393336946085, 0.9089688614894007, \
+        0.90981031333993267, 0.91064828099325079, 0.91148275655437705, 0.91231373216123313, \
+        0.91314119998471655, 0.91396515222877361, 0.91478558113047304, 0.91560247896007851, \
+        0.91641583802112248, 0.9172256506504779, 0.91803190921843081, 0.91883460612875234, \
+        0.91963373381876956, 0.92042928475943786, 0.92122125145541056, 0.92200962644511086, \
+        0.92279440230080123, 0.92357557162865356, 0.92435312706881889, 0.92512706129549716, \
+        0.92589736701700565, 0.92666403697584776, 0.9274270639487816, 0.92818644074688805, \
+        0.92894216021563869, 0.92969421523496187, 0.93044259871931212, 0.93118730361773505, \
+        0.9319283229139339, 0.93266564962633702, 0.93339927680816182, 0.93412919754748214, \
+        0.93485540496729147, 0.93557789222556909, 0.93629665251534377, 0.93701167906475868, \
+        0.93772296513713438, 0.93843050403103256, 0.9391342890803196, 0.93983431365422843, \
+        0.94053057115742233, 0.94122305503005577, 0.94191175874783717, 0.94259667582208961, \
+        0.94327779979981274, 0.94395512426374284, 0.94462864283241377, 0.94529834916021693, \
+        0.94596423693746079, 0.94662629989043101, 0.94728453178144878, 0.94793892640893018, \
+        0.94858947760744439, 0.94923617924777171, 0.94987902523696111, 0.95051800951838805, \
+        0.95115312607181168, 0.95178436891343099, 0.95241173209594121, 0.95303520970859035, \
+        0.9536547958772349, 0.95427048476439436, 0.95488227056930697, 0.95549014752798433, \
+        0.9560941099132656, 0.95669415203487085, 0.95729026823945595, 0.95788245291066465, \
+        0.95847070046918215, 0.95905500537278732, 0.95963536211640499, 0.96021176523215845, \
+        0.96078420928941954, 0.96135268889486147, 0.96191719869250836, 0.96247773336378661, \
+        0.96303428762757393, 0.96358685624025053, 0.96413543399574708, 0.96468001572559503, \
+        0.96522059629897416, 0.96575717062276167, 0.96628973364158033, 0.96681828033784489, \
+        0.96734280573181108, 0.9678633048816212, 0.9683797728833512, 0.96889220487105687, \
+        0.96940059601681927, 0.96990494153079121, 0.97040523666124145, 0.97090147669459936, \
+        0.97139365695550028, 0.97188177280682897, 0.9723658196497631, 0.97284579292381679, \
+        0.97332168810688391, 0.97379350071528026, 0.97426122630378575, 0.97472486046568663, \
+        0.97518439883281705, 0.97563983707559965, 0.97609117090308695, 0.97653839606300141, \
+        0.97698150834177588, 0.97742050356459265, 0.97785537759542329, 0.97828612633706813, \
+        0.97871274573119327, 0.97913523175837014, 0.97955358043811347, 0.9799677878289178, \
+        0.98037785002829536, 0.98078376317281268, 0.98118552343812659, 0.98158312703902117, \
+        0.98197657022944229, 0.98236584930253401, 0.98275096059067224, 0.98313190046550081, \
+        0.98350866533796433, 0.98388125165834239, 0.98424965591628388, 0.98461387464083849, \
+        0.98497390440049082, 0.98532974180319166, 0.98568138349639112, 0.98602882616706866, \
+        0.98637206654176568, 0.98671110138661589, 0.98704592750737552, 0.98737654174945355, \
+        0.98770294099794198, 0.98802512217764416, 0.98834308225310452, 0.98865681822863727, \
+        0.98896632714835353, 0.98927160609619103, 0.98957265219593937, 0.98986946261126918, \
+        0.99016203454575757, 0.99045036524291463, 0.99073445198621002, 0.99101429209909786, \
+        0.99128988294504239, 0.99156122192754248, 0.99182830649015641, 0.99209113411652594, \
+        0.99234970233039943, 0.99260400869565613, 0.99285405081632838, 0.99309982633662452, \
+        0.99334133294095106, 0.99357856835393421, 0.99381153034044178, 0.99404021670560394, \
+        0.99426462529483384, 0.99448475399384839, 0.99470060072868727, 0.99491216346573363, \
+        0.99511944021173215, 0.99532242901380874, 0.99552112795948799, 0.99571553517671219, \
+        0.99590564883385824, 0.99609146713975549, 0.99627298834370182, 0.99645021073548068, \
+        0.99662313264537739, 0.99679175244419449, 0.99695606854326713, 0.99711607939447799, \
+        0.99727178349027246, 0.99742317936367175, 0.99757026558828776, 0.99771304077833589, \
+        0.99785150358864849, 0.99798565271468709, 0.99811548689255503, 0.99824100489900935, \
+        0.99836220555147204, 0.99847908770804183, 0.99859165026750407, 0.99869989216934163, \
+        0.99880381239374483, 0.99890340996162119, 0.99899868393460411, 0.99908963341506229, \
+        0.99917625754610828, 0.99925855551160558, 0.99933652653617766, 0.99941016988521425, \
+        0.99947948486487848, 0.99954447082211417, 0.99960512714465055, 0.99966145326100952, \
+        0.99971344864051004, 0.99976111279327351, 0.99980444527022838, 0.99984344566311423, \
+        0.99987811360448575, 0.99990844876771612, 0.99993445086700039, 0.99995611965735764, \
+        0.99997345493463352, 0.99998645653550244, 0.99999512433746873, 0.99999945825886805, \
+        0.99999945825886805, 0.99999512433746873, 0.99998645653550244, 0.99997345493463352, \
+        0.99995611965735764, 0.99993445086700039, 0.99990844876771612, 0.99987811360448575, \
+        0.99984344566311423, 0.99980444527022838, 0.99976111279327351, 0.99971344864051004, \
+        0.99966145326100952, 0.99960512714465055, 0.99954447082211417, 0.99947948486487848, \
+        0.99941016988521425, 0.99933652653617766, 0.99925855551160558, 0.99917625754610828, \
+        0.99908963341506241, 0.99899868393460411, 0.99890340996162119, 0.99880381239374483, \
+        0.99869989216934163, 0.99859165026750407, 0.99847908770804183, 0.99836220555147215, \
+        0.99824100489900935, 0.99811548689255503, 0.99798565271468709, 0.99785150358864849, \
+        0.99771304077833589, 0.99757026558828776, 0.99742317936367186, 0.99727178349027246, \
+        0.99711607939447811, 0.99695606854326713, 0.99679175244419449, 0.99662313264537739, \
+        0.99645021073548068, 0.99627298834370182, 0.9960914671397556, 0.99590564883385835, \
+        0.99571553517671219, 0.99552112795948799, 0.99532242901380874, 0.99511944021173226, \
+        0.99491216346573363, 0.99470060072868727, 0.99448475399384839, 0.99426462529483384, \
+        0.99404021670560394, 0.99381153034044178, 0.99357856835393421, 0.99334133294095106, \
+        0.99309982633662464, 0.99285405081632838, 0.99260400869565613, 0.99234970233039943, \
+        0.99209113411652594, 0.99182830649015652, 0.99156122192754248, 0.9912898829450425, \
+        0.99101429209909786, 0.99073445198621002, 0.99045036524291463, 0.99016203454575757, \
+        0.98986946261126918, 0.98957265219593937, 0.98927160609619103, 0.98896632714835364, \
+        0.98865681822863727, 0.98834308225310463, 0.98802512217764416, 0.98770294099794198, \
+        0.98737654174945366, 0.98704592750737552, 0.98671110138661589, 0.98637206654176568, \
+        0.98602882616706866, 0.98568138349639112, 0.98532974180319188, 0.98497390440049082, \
+        0.9846138746408386, 0.98424965591628388, 0.9838812516583425, 0.98350866533796433, \
+        0.98313190046550081, 0.98275096059067235, 0.9823658493025339, 0.98197657022944229, \
+        0.98158312703902117, 0.98118552343812659, 0.98078376317281268, 0.98037785002829547, \
+        0.97996778782891791, 0.97955358043811347, 0.97913523175837014, 0.97871274573119316, \
+        0.97828612633706813, 0.9778553775954234, 0.97742050356459265, 0.97698150834177588, \
+        0.97653839606300152, 0.97609117090308706, 0.97563983707559965, 0.97518439883281716, \
+        0.97472486046568663, 0.97426122630378575, 0.97379350071528026, 0.97332168810688402, \
+        0.97284579292381679, 0.9723658196497631, 0.97188177280682908, 0.9713936569555004, \
+        0.97090147669459936, 0.97040523666124145, 0.96990494153079121, 0.96940059601681927, \
+        0.96889220487105676, 0.9683797728833512, 0.96786330488162131, 0.9673428057318112, \
+        0.966818280337845, 0.96628973364158033, 0.9657571706227619, 0.96522059629897416, \
+        0.96468001572559503, 0.96413543399574719, 0.96358685624025053, 0.96303428762757393, \
+        0.96247773336378661, 0.96191719869250858, 0.96135268889486147, 0.96078420928941966, \
+        0.96021176523215845, 0.9596353621164051, 0.95905500537278721, 0.95847070046918215, \
+        0.95788245291066476, 0.95729026823945595, 0.95669415203487085, 0.9560941099132656, \
+        0.95549014752798445, 0.95488227056930697, 0.95427048476439436, 0.95365479587723501, \
+        0.95303520970859046, 0.9524117320959411, 0.95178436891343088, 0.95115312607181179, \
+        0.95051800951838805, 0.94987902523696111, 0.94923617924777171, 0.94858947760744461, \
+        0.94793892640893018, 0.94728453178144878, 0.9466262998904309, 0.94596423693746079, \
+        0.94529834916021682, 0.94462864283241377, 0.94395512426374295, 0.94327779979981285, \
+        0.94259667582208984, 0.94191175874783717, 0.94122305503005599, 0.94053057115742233, \
+        0.93983431365422843, 0.93913428908031948, 0.93843050403103256, 0.93772296513713438, \
+        0.9370116790647588, 0.936296652515344, 0.93557789222556909, 0.93485540496729147, \
+        0.93412919754748225, 0.93339927680816204, 0.93266564962633691, 0.9319283229139339, \
+        0.93118730361773494, 0.93044259871931234, 0.92969421523496198, 0.92894216021563869, \
+        0.92818644074688827, 0.9274270639487816, 0.92666403697584787, 0.92589736701700565, \
+        0.92512706129549727, 0.92435312706881889, 0.92357557162865356, 0.92279440230080123, \
+        0.92200962644511097, 0.92122125145541067, 0.92042928475943797, 0.91963373381876967, \
+        0.91883460612875245, 0.91803190921843092, 0.9172256506504779, 0.91641583802112248, \
+        0.91560247896007851, 0.91478558113047304, 0.91396515222877373, 0.91314119998471655, \
+        0.91231373216123313, 0.91148275655437705, 0.91064828099325101, 0.90981031333993267, \
+        0.9089688614894007, 0.90812393336946073, 0.90727553694066998, 0.90642368019626252, \
+        0.90556837116207456, 0.90470961789646798, 0.90384742849025468, 0.90298181106662079, \
+        0.90211277378104926, 0.90124032482124417, 0.90036447240705209, 0.89948522479038684, \
+        0.8986025902551491, 0.89771657711715014, 0.89682719372403308, 0.89593444845519454, \
+        0.89503834972170448, 0.89413890596622836, 0.89323612566294686, 0.89233001731747641, \
+        0.89142058946678837, 0.89050785067912952, 0.88959180955394113, 0.88867247472177702, \
+        0.88774985484422331, 0.88682395861381624, 0.88589479475396105, 0.88496237201884842, \
+        0.88402669919337318, 0.88308778509305119, 0.88214563856393613, 0.88120026848253641, \
+        0.88025168375573082, 0.87929989332068637, 0.87834490614477156, 0.87738673122547417, \
+        0.87642537759031491, 0.87546085429676379, 0.87449317043215324, 0.87352233511359367, \
+        0.87254835748788695, 0.87157124673144093, 0.87059101205018186, 0.86960766267946843, \
+        0.86862120788400521, 0.86763165695775402, 0.86663901922384756, 0.86564330403450085, \
+        0.86464452077092369, 0.86364267884323187, 0.86263778769035837, 0.8616298567799654, \
+        0.86061889560835381, 0.85960491370037451, 0.85858792060933808, 0.85756792591692632, \
+        0.85654493923309982, 0.85551897019600887, 0.85449002847190181, 0.85345812375503538, \
+        0.85242326576758121, 0.85138546425953621, 0.8503447290086299, 0.84930106982023157, \
+        0.84825449652725937, 0.84720501899008627, 0.84615264709644866, 0.84509739076135149, \
+        0.84403925992697637, 0.84297826456258651, 0.84191441466443417, 0.84084772025566568, \
+        0.839778191386227, 0.838705838132769, 0.83763067059855323, 0.83655269891335582, \
+        0.83547193323337254, 0.83438838374112345, 0.83330206064535528, 0.83221297418094764, \
+        0.83112113460881554, 0.83002655221581145, 0.82892923731463042, 0.82782920024371232, \
+        0.82672645136714307, 0.82562100107455905, 0.82451285978104805, 0.8234020379270508, \
+        0.82228854597826417, 0.82117239442554013, 0.82005359378478948, 0.81893215459688173, \
+        0.81780808742754418, 0.81668140286726554, 0.815552111531194, 0.81442022405903647, \
+        0.8132857511149616, 0.81214870338749634, 0.81100909158942525, 0.80986692645769209, \
+        0.80872221875329564, 0.80757497926119082, 0.80642521879018547, 0.8052729481728389, \
+        0.80411817826536036, 0.8029609199475064, 0.80180118412247747, 0.80063898171681713, \
+        0.79947432368030769, 0.79830722098586682, 0.79713768462944556, 0.79596572562992307, \
+        0.79479135502900444, 0.79361458389111561, 0.79243542330329864, 0.79125388437510868, \
+        0.79006997823850944, 0.78888371604776553, 0.78769510897934059, 0.78650416823179081, \
+        0.78531090502565837, 0.7841153306033678, 0.78291745622911779, 0.78171729318877714, \
+        0.7805148527897775, 0.77931014636100593, 0.77810318525269984, 0.77689398083633954, \
+        0.77568254450453966, 0.77446888767094402, 0.77325302177011723, 0.77203495825743562, \
+        0.77081470860898194, 0.76959228432143445, 0.76836769691196083, 0.76714095791810855, \
+        0.76591207889769652, 0.76468107142870567, 0.76344794710917119, 0.76221271755707098, \
+        0.76097539441021844, 0.75973598932615227, 0.75849451398202516, 0.7572509800744962, \
+        0.75600539931961808, 0.75475778345272915, 0.75350814422834156, 0.75225649342002987, \
+        0.7510028428203217, 0.74974720424058605, 0.74848958951092082, 0.74723001048004323, \
+        0.74596847901517749, 0.74470500700194164, 0.74343960634423834, 0.742172288964139, \
+        0.7409030668017762, 0.73963195181522712, 0.73835895598040191, 0.737084091290932, \
+        0.73580736975805672, 0.73452880341050863, 0.7332484042944023, 0.73196618447312001, \
+        0.73068215602719677, 0.7293963310542092, 0.7281087216686587, 0.72681934000185966, \
+        0.72552819820182402, 0.72423530843314587, 0.72294068287688951, 0.72164433373047232, \
+        0.72034627320755018, 0.71904651353790361, 0.71774506696732177, 0.71644194575748577, \
+        0.71513716218585688, 0.71383072854555618, 0.71252265714525198, 0.71121296030904335, \
+        0.70990165037634212, 0.70858873970175928, 0.70727424065498734, 0.70595816562068259, \
+        0.70464052699835089, 0.70332133720222922, 0.70200060866116831, 0.7006783538185174, \
+        0.69935458513200566, 0.69802931507362409, 0.69670255612951049, 0.69537432079982864, \
+        0.69404462159865377, 0.69271347105385261, 0.69138088170696488, 0.69004686611308697, \
+        0.68871143684075364, 0.6873746064718167, 0.68603638760133001, 0.68469679283742901, \
+        0.68335583480121165, 0.68201352612662092, 0.68066987946032398, 0.6793249074615948, \
+        0.67797862280219412, 0.67663103816624903, 0.67528216625013548, 0.67393201976235773, \
+        0.67258061142342707, 0.67122795396574486, 0.66987406013348127, 0.66851894268245349, \
+        0.6671626143800089, 0.66580508800490157, 0.66444637634717396, 0.66308649220803695, \
+        0.66172544839974556, 0.66036325774548255, 0.65899993307923554, 0.65763548724567544, \
+        0.65626993310003723, 0.6549032835079982, 0.65353555134555485, 0.65216674949890541, \
+        0.65079689086432402, 0.6494259883480431, 0.64805405486612977, 0.64668110334436357, \
+        0.6453071467181164, 0.64393219793223022, 0.64255626994089321, 0.64117937570752059, \
+        0.6398015282046311, 0.63842274041372338, 0.63704302532515644, 0.63566239593802565, \
+        0.63428086526004013, 0.63289844630740133, 0.63151515210467823, 0.63013099568468733, \
+        0.62874599008836873, 0.62736014836466159, 0.62597348357038407, 0.62458600877010917, \
+        0.62319773703603976, 0.62180868144788926, 0.62041885509275407, 0.61902827106499392, \
+        0.61763694246610701, 0.6162448824046054, 0.61485210399589385, 0.61345862036214494, \
+        0.61206444463217458, 0.61066958994132037, 0.60927406943131657, 0.6078778962501703, \
+        0.60648108355203845, 0.60508364449710195, 0.60368559225144414, 0.6022869399869254, \
+        0.60088770088105847, 0.59948788811688591, 0.59808751488285516, 0.59668659437269311, \
+        0.59528513978528363, 0.59388316432454302, 0.59248068119929331, 0.5910777036231416, \
+        0.58967424481435138, 0.58827031799572183, 0.58686593639446116, 0.58546111324206129, \
+        0.58405586177417534, 0.58265019523049211, 0.58124412685460924, 0.57983766989391261, \
+        0.57843083759944813, 0.57702364322579713, 0.57561610003095387, 0.57420822127619742, \
+        0.57280002022596965, 0.57139151014774892, 0.56998270431192377, 0.56857361599167067, \
+        0.56716425846282736, 0.56575464500376704, 0.56434478889527495, 0.56293470342042295, \
+        0.56152440186444219, 0.56011389751460161, 0.55870320366007897, 0.55729233359183894, \
+        0.55588130060250607, 0.55447011798623902, 0.55305879903860655, 0.55164735705646351, \
+        0.55023580533782135, 0.54882415718172683, 0.54741242588813566, 0.54600062475778532, \
+        0.54458876709207305, 0.54317686619292704, 0.54176493536268411, 0.54035298790396302, \
+        0.538941037119538, 0.53752909631221579, 0.53611717878470921, 0.53470529783951037, \
+        0.5332934667787681, 0.53188169890416115, 0.53047000751677187, 0.52905840591696329, \
+        0.52764690740425135, 0.52623552527718154, 0.52482427283320265, 0.52341316336854149, \
+        0.52200221017807802, 0.52059142655521984, 0.51918082579177627, 0.51777042117783445, \
+        0.516360226001634, 0.51495025354943991, 0.51354051710542015, 0.51213102995151782, \
+        0.51072180536732825, 0.50931285662997328, 0.50790419701397438, 0.50649583979113022, \
+        0.50508779823039063, 0.50368008559773014, 0.50227271515602523, 0.50086570016492882, \
+        0.49945905388074341, 0.49805278955629939, 0.49664692044082648, 0.49524145977983336, \
+        0.49383642081497914, 0.49243181678394915, 0.49102766092033212, 0.48962396645349432, \
+        0.48822074660845377, 0.48681801460575802, 0.48541578366135829, 0.48401406698648403, \
+        0.48261287778752077, 0.48121222926588303, 0.47981213461789235, 0.47841260703465199, \
+        0.47701365970192133, 0.47561530579999411, 0.474217558503573, 0.47282043098164417, \
+        0.47142393639735591, 0.47002808790789319, 0.46863289866435204, 0.46723838181162025, \
+        0.46584455048824791, 0.46445141782632776, 0.46305899695137009, 0.46166730098217795, \
+        0.46027634303072573, 0.4588861362020345, 0.45749669359404743, 0.45610802829750879, \
+        0.45472015339583921, 0.45333308196501143, 0.45194682707342976, 0.45056140178180387, \
+        0.44917681914302854, 0.44779309220205937, 0.44641023399578872, 0.4450282575529253, \
+        0.44364717589387026, 0.44226700203059321, 0.44088774896651184, 0.43950942969636936, \
+        0.43813205720610909, 0.436755644472756, 0.43538020446429115, 0.43400575013953202, \
+        0.43263229444800955, 0.43125985032984471, 0.4298884307156291, 0.42851804852630188, \
+        0.42714871667302667, 0.42578044805707271, 0.42441325556969173, 0.42304715209199539, \
+        0.42168215049483682, 0.42031826363868613, 0.41895550437351192, 0.41759388553865917, \
+        0.416233419962727, 0.41487412046345018, 0.41351599984757681, 0.4121590709107481, \
+        0.41080334643737759, 0.40944883920053143, 0.4080955619618063, 0.40674352747121184, \
+        0.40539274846704754, 0.40404323767578532, 0.40269500781194867, 0.40134807157799135, \
+        0.40000244166418042, 0.39865813074847523, 0.39731515149640712, 0.39597351656096191, \
+        0.39463323858246013, 0.39329433018843618, 0.39195680399352273, 0.39062067259932798, \
+        0.38928594859432042, 0.38795264455370848, 0.38662077303932085, 0.38529034659949191, \
+        0.3839613777689399, 0.38263387906864932, 0.38130786300575492, 0.37998334207342266, \
+        0.3786603287507308, 0.3773388355025552, 0.37601887477944851, 0.3747004590175258, \
+        0.3733836006383463, 0.37206831204879487, 0.37075460564096774, 0.36944249379205446, \
+        0.36813198886422016, 0.36682310320449141, 0.36551584914463869, 0.36421023900105909, \
+        0.3629062850746626, 0.36160399965075496, 0.36030339499892056, 0.3590044833729108, \
+        0.35770727701052346, 0.35641178813349167, 0.35511802894736705, 0.3538260116414037, \
+        0.35253574838844548, 0.35124725134481055, 0.34996053265017518, 0.34867560442746209, \
+        0.34739247878272483, 0.34611116780503282, 0.34483168356635974, 0.34355403812146723, \
+        0.34227824350779357, 0.34100431174533941, 0.339732254836553, 0.33846208476621997, \
+        0.3371938135013488, 0.33592745299105714, 0.33466301516646096, 0.33340051194056264, \
+        0.33213995520813555, 0.33088135684561548, 0.32962472871098636, 0.32837008264366996, \
+        0.32711743046441422, 0.32586678397518043, 0.32461815495903396, 0.32337155518003258, \
+        0.32212699638311437, 0.32088449029398902, 0.31964404861902673, 0.31840568304514649, \
+        0.31716940523970838, 0.31593522685040121, 0.31470315950513505, 0.31347321481193047, \
+        0.31224540435880821, 0.31101973971368235, 0.30979623242424958, 0.30857489401788085, \
+        0.30735573600151295, 0.30613876986154021, 0.30492400706370493, 0.30371145905299202, \
+        0.30250113725351802, 0.30129305306842619, 0.30008721787977788, 0.29888364304844428, \
+        0.29768233991400156, 0.29648331979462283, 0.29528659398697066, 0.29409217376609259, \
+        0.29290007038531374, 0.29171029507613011, 0.29052285904810482, 0.28933777348876, \
+        0.28815504956347365, 0.28697469841537337, 0.28579673116523019, 0.28462115891135709, \
+        0.28344799272950122, 0.28227724367274026, 0.28110892277137972, 0.27994304103284806, \
+        0.27877960944159175, 0.27761863895897465, 0.27646014052317164, 0.27530412504906798, \
+        0.27415060342815545, 0.27299958652842898, 0.27185108519428586, 0.27070511024642302, \
+        0.26956167248173357, 0.26842078267320751, 0.2672824515698291, 0.2661466898964745, \
+        0.26501350835381304, 0.26388291761820387, 0.26275492834159747, 0.2616295511514351, \
+        0.26050679665054643, 0.2593866754170524, 0.2582691980042644, 0.25715437494058385, \
+        0.25604221672940508, 0.25493273384901527, 0.25382593675249476, 0.25272183586762093, \
+        0.25162044159676711, 0.25052176431680728, 0.24942581437901679, 0.24833260210897445, \
+        0.24724213780646676, 0.24615443174538981, 0.24506949417365204, 0.24398733531307926, \
+        0.2429079653593173, 0.24183139448173518, 0.24075763282333118, 0.23968669050063601, \
+        0.23861857760361771, 0.23755330419558707, 0.23649088031310134, 0.23543131596587175, \
+        0.23437462113666824, 0.23332080578122438, 0.23226987982814545, 0.231221853178814, \
+        0.23017673570729574, 0.22913453726024841, 0.22809526765682675, 0.22705893668859217, \
+        0.22602555411941938, 0.22499512968540369, 0.223967673094771, 0.22294319402778529, \
+        0.22192170213665691, 0.22090320704545269, 0.21988771835000598, 0.21887524561782307, \
+        0.21786579838799686, 0.21685938617111378, 0.21585601844916691, 0.21485570467546494, \
+        0.21385845427454303, 0.21286427664207525, 0.21187318114478526, 0.21088517712035748, \
+        0.20990027387735039, 0.20891848069510838, 0.2079398068236733, 0.20696426148369923, \
+        0.20599185386636348, 0.20502259313328175, 0.20405648841642138, 0.203093548818014, \
+        0.20213378341047167, 0.20117720123630045, 0.20022381130801514, 0.19927362260805459, \
+        0.19832664408869743, 0.19738288467197618, 0.1964423532495958, 0.19550505868284707, \
+        0.19457100980252545, 0.19364021540884685, 0.19271268427136401, 0.19178842512888533, \
+        0.19086744668939204, 0.18994975762995492, 0.18903536659665465, 0.18812428220449912, \
+        0.18721651303734177, 0.18631206764780234, 0.18541095455718426, 0.18451318225539631, \
+        0.18361875920087178, 0.18272769382048765, 0.18183999450948785, 0.18095566963140192, \
+        0.18007472751796633, 0.17919717646904748, 0.17832302475256229, 0.1774522806044001, \
+        0.17658495222834658, 0.17572104779600423, 0.17486057544671757, 0.17400354328749523, \
+        0.17314995939293343, 0.17229983180514058, 0.1714531685336616, 0.17060997755540114, \
+        0.16977026681455021, 0.1689340442225104, 0.16810131765781872, 0.16727209496607509, \
+        0.16644638395986644, 0.16562419241869447, 0.16480552808890281, 0.16399039868360166, \
+        0.1631788118825977, 0.16237077533232047, 0.16156629664575017, 0.1607653834023467, \
+        0.15996804314797797, 0.15917428339484802, 0.15838411162142785, 0.15759753527238296, \
+        0.15681456175850522, 0.15603519845664182, 0.1552594527096256, 0.15448733182620689, \
+        0.15371884308098405, 0.15295399371433427, 0.15219279093234689, 0.1514352419067545, \
+        0.15068135377486491, 0.14993113363949517, 0.14918458856890393, 0.14844172559672469, \
+        0.14770255172190022, 0.1469670739086153, 0.14623529908623278, 0.14550723414922745, \
+        0.14478288595712041, 0.14406226133441591, 0.14334536707053619, 0.142632209919757, \
+        0.14192279660114554, 0.14121713379849515, 0.14051522816026424, 0.13981708629951267, \
+        0.13912271479383886, 0.13843212018531936, 0.13774530898044629, 0.13706228765006545, \
+        0.13638306262931676, 0.1357076403175726, 0.13503602707837797, 0.13436822923939035, \
+        0.13370425309231981, 0.1330441048928705, 0.1323877908606812, 0.13173531717926623, \
+        0.13108668999595846, 0.13044191542185046, 0.12980099953173674, 0.12916394836405737, \
+        0.12853076792084067, 0.12790146416764603, 0.1272760430335092, 0.12665451041088449, \
+        0.12603687215559106, 0.12542313408675698, 0.12481330198676371, 0.1242073816011931, \
+        0.12360537863877219, 0.12300729877131922, 0.1224131476336916, 0.12182293082373141, \
+        0.12123665390221289, 0.12065432239279084, 0.12007594178194747, 0.11950151751894178, \
+        0.11893105501575774, 0.11836455964705267, 0.11780203675010797, 0.11724349162477776, \
+        0.11668892953343901, 0.11613835570094261, 0.11559177531456377, 0.11504919352395265, \
+        0.11451061544108704, 0.11397604614022266, 0.11344549065784681, 0.11291895399263024, \
+        0.11239644110537961, 0.11187795691899149, 0.11136350631840636, 0.11085309415056083, \
+        0.11034672522434386, 0.10984440431055048, 0.10934613614183691, 0.10885192541267635, \
+        0.10836177677931447, 0.10787569485972531, 0.10739368423356849, 0.1069157494421451, \
+        0.10644189498835588, 0.10597212533665823, 0.10550644491302408, 0.10504485810489839, \
+        0.10458736926115825, 0.1041339826920708, 0.10368470266925361, 0.1032395334256343, \
+        0.10279847915540985, 0.10236154401400832, 0.10192873211804881, 0.10150004754530284, \
+        0.1010754943346564, 0.10065507648607086, 0.10023879796054658, 0.099826662680084777, \
+        0.099418674527650464, 0.099014837347136564, 0.098615154943327177, 0.098219631081861547, \
+        0.097828269489199426, 0.097441073852584825, 0.097058047820012372, 0.096679195000192231, \
+        0.096304518962516072, 0.095934023237024102, 0.095567711314371251, 0.095205586645794205, \
+        0.094847652643079372, 0.094493912678530356, 0.094144370084936257, 0.093799028155540476, \
+        0.093457890144009181, 0.093120959264401393, 0.092788238691138225, 0.092459731558972691, \
+        0.092135440962960946, 0.091815369958432702, 0.091499521560962083, 0.091187898746339924, \
+        0.090880504450545463, 0.090577341569718195, 0.090278412960131449, 0.089983721438164688, \
+        0.089693269780277585, 0.089407060722983545, 0.089125096962823669, 0.088847381156342109, \
+        0.088573915920060364, 0.088304703830452635, 0.088039747423922288, 0.087779049196777093, \
+        0.087522611605205858, 0.08727043706525589, 0.08702252795280957, 0.086778886603562311, \
+        0.086539515313000415, 0.086304416336379419, 0.086073591888703005, 0.085847044144702123, \
+        0.085624775238814288, 0.085406787265163542, 0.08519308227754091, 0.084983662289384976, \
+        0.084778529273762726, 0.084577685163351013, 0.084381131850418789, 0.084188871186808623, \
+        0.084000904983919489, 0.08381723501268995, 0.083637863003581336, 0.083462790646561091, \
+        0.083292019591087452, 0.083125551446093404, 0.082963387779971753, 0.082805530120560411, \
+        0.082651979955127852, 0.082502738730359015, 0.082357807852342202, 0.082217188686554865, \
+        0.082080882557851842, 0.081948890750452086, 0.081821214507926898, 0.081697855033188105, \
+        0.081578813488476842, 0.081464090995352401, 0.081353688634681842, 0.081247607446629844, \
+        0.081145848430648648, 0.081048412545469017, 0.080955300709090794, 0.080866513798774464, \
+        0.080782052651033109, 0.080701918061624023, 0.080626110785541716, 0.080554631537010313, \
+        0.080487480989477278, 0.080424659775606866, 0.08036616848727407, 0.080312007675559238, \
+        0.080262177850742689, 0.080216679482300213, 0.080175512998898191, 0.080138678788389928, \
+        0.080106177197811879, 0.080078008533380318, 0.08005417306048862, 0.080034671003704538, \
+        0.080019502546768262, 0.080008667832590641, 0.080002166963251742, 0.080000000000000016 \
+    }
+
+#endif // FFT_TABLES_2048_H
@@ -0,0 +1,329 @@
+#ifndef IIR_H
+#define IIR_H
+
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*
+ * IIRフィルタ（2次セクション＝biquad の縦続接続）の設計と実行
+ *
+ * 設計: アナログ原型（バタワース・チェビシェフI型・楕円）の極と零点を求め、
+ *       周波数変換（低域／高域）→ 双一次変換 で z 平面に移し、
+ *       共役な極の組ごとに biquad にまとめる。
+ *       各セクションは通過域の基準点（低域なら直流、高域ならナイキスト）で利得1に正規化する。
+ * 実行: 転置型直接形II。ブロック単位で、セクションを外側・サンプルを内側のループにして
+ *       係数と状態をレジスタに置いたまま1セクション分を流す。
+ *
+ * 周波数は課題5と同じく、ナイキスト周波数を1とした正規化周波数で指定する。
+ */
+
+#define IIR_MAX_ORDER 20
+#define IIR_MAX_SECTIONS ((IIR_MAX_ORDER + 1) / 2)
+
+enum { IIR_BUTTER = 0, IIR_CHEBY1, IIR_ELLIP };
+enum { IIR_LOWPASS = 0, IIR_HIGHPASS };
+
+// 1セクション: H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+typedef struct {
+    double b0, b1, b2;
+    double a1, a2;
+} iir_biquad;
+
+typedef struct {
+    int sections;
+    iir_biquad s[IIR_MAX_SECTIONS];
+    double z1[IIR_MAX_SECTIONS]; // 転置型直接形IIの状態
+    double z2[IIR_MAX_SECTIONS];
+} iir_cascade;
+
+// ---- 楕円関数（楕円フィルタの設計用） ----
+
+static inline double iir_agm(double a, double b)
+{
+    for (int i = 0; i < 64 && fabs(a - b) > 1e-16 * a; i++) {
+        double t = 0.5 * (a + b);
+        b = sqrt(a * b);
+        a = t;
+    }
+    return a;
+}
+
+// 第1種完全楕円積分 K(m)（m はパラメータ = 母数の2乗）
+static inline double iir_ellipk(double m)
+{
+    return M_PI / (2.0 * iir_agm(1.0, sqrt(1.0 - m)));
+}
+
+// K(1 - m)。m が小さいときも精度を落とさない
+static inline double iir_ellipkm1(double m)
+{
+    return M_PI / (2.0 * iir_agm(1.0, sqrt(m)));
+}
+
+// Carlson の R_F(x, y, z)
+static inline double iir_carlson_rf(double x, double y, double z)
+{
+    for (int i = 0; i < 100; i++) {
+        double lambda = sqrt(x * y) + sqrt(y * z) + sqrt(z * x);
+        x = 0.25 * (x + lambda);
+        y = 0.25 * (y + lambda);
+        z = 0.25 * (z + lambda);
+        double mu = (x + y + z) / 3.0;
+        if (fabs(x - mu) < 1e-12 * mu && fabs(y - mu) < 1e-12 * mu && fabs(z - mu) < 1e-12 * mu)
+            break;
+    }
+    double mu = (x + y + z) / 3.0;
+    double dx = 1.0 - x / mu, dy = 1.0 - y / mu, dz = 1.0 - z / mu;
+    double e2 = dx * dy + dy * dz + dz * dx, e3 = dx * dy * dz;
+    return (1.0 - e2 / 10.0 + e3 / 14.0 + e2 * e2 / 24.0 - 3.0 * e2 * e3 / 44.0) / sqrt(mu);
+}
+
+// 第1種不完全楕円積分 F(φ | 1 - mc)（補パラメータ mc で指定）
+static inline double iir_ellipf_comp(double phi, double mc)
+{
+    double s = sin(phi), c = cos(phi);
+    return s * iir_carlson_rf(c * c, c * c + mc * s * s, 1.0);
+}
+
+// ヤコビの楕円関数 sn, cn, dn（AGM法）
+static inline void iir_ellipj(double u, double m, double *sn, double *cn, double *dn)
+{
+    double a[16], c[16];
+    a[0] = 1.0;
+    double b = sqrt(1.0 - m);
+    c[0] = sqrt(m);
+    int n = 0;
+    while (n < 15 && fabs(c[n]) > 1e-16) {
+        a[n + 1] = 0.5 * (a[n] + b);
+        c[n + 1] = 0.5 * (a[n] - b);
+        b = sqrt(a[n] * b);
+        n++;
+    }
+    double phi = ldexp(a[n] * u, n);
+    for (; n > 0; n--)
+        phi = 0.5 * (phi + asin(c[n] / a[n] * sin(phi)));
+    *sn = sin(phi);
+    *cn = cos(phi);
+    *dn = sqrt(1.0 - m * (*sn) * (*sn));
+}
+
+// 次数 n と選択度 m1 から楕円フィルタの母数を求める（次数方程式）
+static inline double iir_ellipdeg(int n, double m1)
+{
+    double q1 = exp(-M_PI * iir_ellipkm1(m1) / iir_ellipk(m1));
+    double q = pow(q1, 1.0 / n);
+    double num = 0.0, den = 0.0;
+    for (int i = 0; i < 7; i++)
+        num += pow(q, (double)i * (i + 1));
+    for (int i = 1; i < 8; i++)
+        den += pow(q, (double)i * i);
+    double r = num / (1.0 + 2.0 * den);
+    return 16.0 * q * r * r * r * r;
+}
+
+// ---- 設計 ----
+
+/*
+ * アナログ原型（通過域端 1 rad/s）の極・零点のうち、虚部が0以上のものを返す。
+ * 極: 共役対の代表 + 奇数次なら実極1つ。零点: 楕円フィルタのみ（虚軸上の共役対の代表）。
+ */
+static inline void iir_prototype(int type, int order, double rp, double rs,
+                                 double complex *poles, int *npoles, double complex *zeros, int *nzeros)
+{
+    *npoles = 0;
+    *nzeros = 0;
+    if (type == IIR_BUTTER) {
+        for (int k = 0; k < (order + 1) / 2; k++) {
+            double theta = M_PI * (2 * k + order + 1) / (2.0 * order);
+            poles[(*npoles)++] = -fabs(cos(theta)) + I * fabs(sin(theta));
+        }
+    } else if (type == IIR_CHEBY1) {
+        double eps = sqrt(pow(10.0, 0.1 * rp) - 1.0);
+        double mu = asinh(1.0 / eps) / order;
+        for (int k = 0; k < (order + 1) / 2; k++) {
+            double theta = M_PI * (2 * k + 1) / (2.0 * order);
+            poles[(*npoles)++] = -sinh(mu) * sin(theta) + I * fabs(cosh(mu) * cos(theta));
+        }
+    } else {
+        double eps = sqrt(pow(10.0, 0.1 * rp) - 1.0);
+        double ck1 = eps / sqrt(pow(10.0, 0.1 * rs) - 1.0);
+        double m = iir_ellipdeg(order, ck1 * ck1);
+        double capk = iir_ellipk(m);
+        double r = iir_ellipf_comp(atan(1.0 / eps), ck1 * ck1);
+        double v0 = capk * r / (order * iir_ellipk(ck1 * ck1));
+        double sv, cv, dv;
+        iir_ellipj(v0, 1.0 - m, &sv, &cv, &dv);
+        for (int j = 1 - order % 2; j < order; j += 2) {
+            double s, c, d;
+            iir_ellipj(j * capk / order, m, &s, &c, &d);
+            if (fabs(s) > 1e-12)
+                zeros[(*nzeros)++] = I / (sqrt(m) * s);
+            double complex p = -(c * d * sv * cv + I * s * dv) / (1.0 - (d * sv) * (d * sv));
+            poles[(*npoles)++] = creal(p) + I * fabs(cimag(p));
+        }
+    }
+}
+
+// s 平面の点を 周波数変換 → 双一次変換 で z 平面へ（wo は予歪みした角周波数）
+static inline double complex iir_s_to_z(double complex s, int band, double wo)
+{
+    s = (band == IIR_LOWPASS) ? s * wo : wo / s;
+    return (2.0 + s) / (2.0 - s);
+}
+
+// 正規化周波数 w（ナイキスト = 1）でのセクションの複素応答
+static inline double complex iir_biquad_response(const iir_biquad *q, double w)
+{
+    double complex z1 = cexp(-I * M_PI * w), z2 = z1 * z1;
+    return (q->b0 + q->b1 * z1 + q->b2 * z2) / (1.0 + q->a1 * z1 + q->a2 * z2);
+}
+
+/**
+ * @brief IIRフィルタを設計する
+ *
+ * @param f 設計結果（状態は0に初期化される）
+ * @param type IIR_BUTTER / IIR_CHEBY1 / IIR_ELLIP
+ * @param band IIR_LOWPASS / IIR_HIGHPASS
+ * @param order 次数（1〜IIR_MAX_ORDER）
+ * @param wc 遮断周波数（ナイキスト = 1。チェビシェフ・楕円では通過域端）
+ * @param rp 通過域リップル [dB]（チェビシェフ・楕円）
+ * @param rs 阻止域減衰量 [dB]（楕円）
+ * @return 成功なら0、引数が範囲外なら-1
+ */
+static inline int iir_design(iir_cascade *f, int type, int band, int order, double wc, double rp, double rs)
+{
+    if (order < 1 || order > IIR_MAX_ORDER || wc <= 0.0 || wc >= 1.0 ||
+        (type != IIR_BUTTER && rp <= 0.0) || (type == IIR_ELLIP && rs <= rp))
+        return -1;
+
+    double complex ap[IIR_MAX_SECTIONS], az[IIR_MAX_SECTIONS];
+    int np, nz;
+    iir_prototype(type, order, rp, rs, ap, &np, az, &nz);
+
+    double wo = 2.0 * tan(M_PI * wc / 2.0);
+    double complex zp[IIR_MAX_SECTIONS], zz[IIR_MAX_SECTIONS];
+    for (int i = 0; i < np; i++)
+        zp[i] = iir_s_to_z(ap[i], band, wo);
+    for (int i = 0; i < nz; i++)
+        zz[i] = iir_s_to_z(az[i], band, wo);
+    // 無限遠の零点は 低域なら z = -1、高域なら z = 1 に移る
+    double zinf = (band == IIR_LOWPASS) ? -1.0 : 1.0;
+
+    // 極を単位円から遠い順に並べる（共振の強いセクションを後段に）
+    for (int i = 1; i < np; i++) {
+        for (int j = i; j > 0 && cabs(zp[j]) < cabs(zp[j - 1]); j--) {
+            double complex t = zp[j]; zp[j] = zp[j - 1]; zp[j - 1] = t;
+        }
+    }
+
+    memset(f, 0, sizeof(*f));
+    int used[IIR_MAX_SECTIONS] = {0};
+    for (int i = np - 1; i >= 0; i--) {
+        iir_biquad *q = &f->s[i];
+        int real_pole = fabs(cimag(zp[i])) < 1e-12;
+        if (real_pole) {
+            // 1次セクション（実極と実零点1つ）
+            q->a1 = -creal(zp[i]);
+            q->a2 = 0.0;
+            q->b0 = 1.0;
+            q->b1 = -zinf;
+            q->b2 = 0.0;
+        } else {
+            q->a1 = -2.0 * creal(zp[i]);
+            q->a2 = cabs(zp[i]) * cabs(zp[i]);
+            // 残っている零点対のうち、この極に最も近いものを組み合わせる
+            int best = -1;
+            for (int k = 0; k < nz; k++) {
+                if (!used[k] && (best < 0 || cabs(zz[k] - zp[i]) < cabs(zz[best] - zp[i])))
+                    best = k;
+            }
+            q->b0 = 1.0;
+            if (best >= 0) {
+                used[best] = 1;
+                q->b1 = -2.0 * creal(zz[best]);
+                q->b2 = cabs(zz[best]) * cabs(zz[best]);
+            } else {
+                q->b1 = -2.0 * zinf;
+                q->b2 = 1.0;
+            }
+        }
+        // 通過域の基準点で利得1に正規化
+        double g = cabs(iir_biquad_response(q, band == IIR_LOWPASS ? 0.0 : 1.0));
+        q->b0 /= g;
+        q->b1 /= g;
+        q->b2 /= g;
+    }
+    f->sections = np;
+
+    // 偶数次のチェビシェフ・楕円は基準点がリップルの谷（-rp dB）になる
+    if (type != IIR_BUTTER && order % 2 == 0) {
+        double g = pow(10.0, -rp / 20.0);
+        f->s[0].b0 *= g;
+        f->s[0].b1 *= g;
+        f->s[0].b2 *= g;
+    }
+    return 0;
+}
+
+// 名前（"butter", "cheby1", "ellip"）から種類を得る。不明なら-1
+static inline int iir_type_from_name(const char *name)
+{
+    if (strcmp(name, "butter") == 0)
+        return IIR_BUTTER;
+    if (strcmp(name, "cheby1") == 0)
+        return IIR_CHEBY1;
+    if (strcmp(name, "ellip") == 0)
+        return IIR_ELLIP;
+    return -1;
+}
+
+// 正規化周波数 w（ナイキスト = 1）での振幅特性
+static inline double iir_magnitude(const iir_cascade *f, double w)
+{
+    double complex h = 1.0;
+    for (int i = 0; i < f->sections; i++)
+        h *= iir_biquad_response(&f->s[i], w);
+    return cabs(h);
+}
+
+// ---- 実行 ----
+
+static inline void iir_reset(iir_cascade *f)
+{
+    memset(f->z1, 0, sizeof(f->z1));
+    memset(f->z2, 0, sizeof(f->z2));
+}
+
+/**
+ * @brief n サンプルをフィルタに通す（in と out は同じ配列でもよい）
+ *
+ * 状態は f に残るので、続きのブロックをそのまま渡せる。
+ */
+static inline void iir_process(iir_cascade *f, const double *in, double *out, int n)
+{
+    const double *x = in;
+    for (int k = 0; k < f->sections; k++) {
+        const double b0 = f->s[k].b0, b1 = f->s[k].b1, b2 = f->s[k].b2;
+        const double a1 = f->s[k].a1, a2 = f->s[k].a2;
+        double z1 = f->z1[k], z2 = f->z2[k];
+        for (int i = 0; i < n; i++) {
+            double xi = x[i];
+            double y = b0 * xi + z1;
+            z1 = b1 * xi - a1 * y + z2;
+            z2 = b2 * xi - a2 * y;
+            out[i] = y;
+        }
+        f->z1[k] = z1;
+        f->z2[k] = z2;
+        x = out; // 2段目以降は前段の出力をその場で処理
+    }
+    if (f->sections == 0 && out != in)
+        memcpy(out, in, sizeof(double) * n);
+}
+
+#endif // IIR_H
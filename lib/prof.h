@@ -0,0 +1,289 @@
+#ifndef PROF_H
+#define PROF_H
+
+/*
+ * 処理段ごとの時間・件数を計測する軽量プロファイラ（ヘッダのみ）
+ *
+ * 使い方:
+ *   int main(int argc, char *argv[]) {
+ *       prof_init(&argc, argv);        // --prof / --prof=json を取り除く
+ *       PROF_BEGIN(fft);
+ *       fft1024(xr, xi);
+ *       PROF_END(fft);
+ *       PROF_COUNT(fft, frames, 1);    // samples / frames / bytes / allocs
+ *   }
+ *
+ * 環境変数 AUDIO_PROF=1（または text）か --prof で終了時に段ごとの内訳を、
+ * AUDIO_PROF=json か --prof=json でJSONを標準エラーに出力する。
+ * どちらも指定しなければ時刻の取得もしない。
+ * 集計表はスレッドごと（_Thread_local）なので、ワーカースレッド内でもロックなしで使える。
+ * PROF_BEGIN は開始時刻をその段の集計表に記録するだけの文なので、
+ * 同じ段を同じスコープで何度計っても、if 文の中に1文で書いてもよい
+ * （ただし同じ段の入れ子は数えられない）。
+ * -DPROF_DISABLE でコンパイルするとマクロはすべて空になる。
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum { PROF_OFF = 0, PROF_TEXT, PROF_JSON };
+
+// 環境変数 AUDIO_PROF と引数 --prof[=json] から出力形式を決め、引数は argv から取り除く
+static inline int prof_parse_args(int *argc, char **argv)
+{
+    int mode = PROF_OFF;
+    const char *env = getenv("AUDIO_PROF");
+    if (env && *env && strcmp(env, "0") != 0)
+        mode = (strcmp(env, "json") == 0) ? PROF_JSON : PROF_TEXT;
+
+    int out = 1;
+    for (int i = 1; i < *argc; i++) {
+        if (strcmp(argv[i], "--prof") == 0) {
+            mode = PROF_TEXT;
+        } else if (strcmp(argv[i], "--prof=json") == 0) {
+            mode = PROF_JSON;
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+    argv[out] = NULL;
+    return mode;
+}
+
+#ifdef PROF_DISABLE
+
+#define PROF_BEGIN(stage) ((void)0)
+#define PROF_END(stage) ((void)0)
+#define PROF_COUNT(stage, field, n) ((void)0)
+static inline void prof_init(int *argc, char **argv) { prof_parse_args(argc, argv); }
+static inline void prof_thread_name(const char *name) { (void)name; }
+
+#else
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define PROF_MAX_STAGES 32
+#define PROF_MAX_THREADS 64
+
+typedef struct {
+    uint64_t t0;    // 直近の PROF_BEGIN の時刻
+    uint64_t calls;
+    uint64_t ticks;
+    uint64_t samples;
+    uint64_t frames;
+    uint64_t bytes;
+    uint64_t allocs;
+} prof_stage;
+
+typedef struct {
+    const char *name;
+    prof_stage stage[PROF_MAX_STAGES];
+} prof_thread;
+
+static int prof_mode = PROF_OFF;
+static const char *prof_names[PROF_MAX_STAGES];
+static atomic_int prof_nstages;
+static pthread_mutex_t prof_lock = PTHREAD_MUTEX_INITIALIZER;
+static prof_thread prof_threads[PROF_MAX_THREADS];
+static atomic_int prof_nthreads;
+static _Thread_local prof_thread *prof_self;
+static uint64_t prof_tick0, prof_ns0;
+
+// 時刻（x86 は TSC、それ以外は clock_gettime のナノ秒）
+static inline uint64_t prof_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+}
+
+static inline uint64_t prof_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// 段名をIDに変換する（呼び出し側の static 変数にキャッシュされる）
+static inline int prof_stage_id(atomic_int *cache, const char *name)
+{
+    int id = atomic_load_explicit(cache, memory_order_acquire);
+    if (id >= 0)
+        return id;
+
+    pthread_mutex_lock(&prof_lock);
+    int n = atomic_load(&prof_nstages);
+    for (id = 0; id < n; id++) {
+        if (strcmp(prof_names[id], name) == 0)
+            break;
+    }
+    if (id == n) {
+        if (n < PROF_MAX_STAGES) {
+            prof_names[n] = name;
+            atomic_store(&prof_nstages, n + 1);
+        } else {
+            id = PROF_MAX_STAGES - 1; // あふれた分は最後の段にまとめる
+        }
+    }
+    pthread_mutex_unlock(&prof_lock);
+    atomic_store_explicit(cache, id, memory_order_release);
+    return id;
+}
+
+// 呼び出しスレッドの集計表（初回に確保）
+static inline prof_stage *prof_get(int id)
+{
+    if (!prof_self) {
+        int t = atomic_fetch_add(&prof_nthreads, 1);
+        if (t >= PROF_MAX_THREADS)
+            t = PROF_MAX_THREADS - 1; // あふれたスレッドは最後の枠を共有（値は概算）
+        prof_self = &prof_threads[t];
+    }
+    return &prof_self->stage[id];
+}
+
+// 呼び出しスレッドに表示名をつける
+static inline void prof_thread_name(const char *name)
+{
+    if (prof_mode != PROF_OFF) {
+        prof_get(0);
+        prof_self->name = name;
+    }
+}
+
+#define PROF_BEGIN(stage)                                              \
+    do {                                                               \
+        if (prof_mode) {                                               \
+            static atomic_int prof_id_ = -1;                           \
+            prof_get(prof_stage_id(&prof_id_, #stage))->t0 = prof_now(); \
+        }                                                              \
+    } while (0)
+
+#define PROF_END(stage)                                                \
+    do {                                                               \
+        if (prof_mode) {                                               \
+            static atomic_int prof_id_ = -1;                           \
+            prof_stage *s_ = prof_get(prof_stage_id(&prof_id_, #stage)); \
+            s_->ticks += prof_now() - s_->t0;                          \
+            s_->calls++;                                               \
+        }                                                              \
+    } while (0)
+
+#define PROF_COUNT(stage, field, n)                                    \
+    do {                                                               \
+        if (prof_mode) {                                               \
+            static atomic_int prof_id_ = -1;                           \
+            prof_get(prof_stage_id(&prof_id_, #stage))->field += (n);  \
+        }                                                              \
+    } while (0)
+
+// 1組の PROF_BEGIN/PROF_END にかかる時間（ns）を見積もる
+static inline double prof_overhead_ns(double ns_per_tick)
+{
+    static prof_stage dummy;
+    const int reps = 10000;
+    uint64_t t0 = prof_now();
+    for (int i = 0; i < reps; i++) {
+        dummy.t0 = prof_now();
+        dummy.ticks += prof_now() - dummy.t0;
+        dummy.calls++;
+    }
+    return (double)(prof_now() - t0) * ns_per_tick / reps;
+}
+
+// 終了時に呼ばれ、集計結果を標準エラーに出力する
+static inline void prof_report(void)
+{
+    uint64_t tick1 = prof_now();
+    uint64_t ns1 = prof_now_ns();
+    double wall_ns = (double)(ns1 - prof_ns0);
+    double ns_per_tick = (tick1 > prof_tick0) ? wall_ns / (double)(tick1 - prof_tick0) : 1.0;
+    double cost_ns = prof_overhead_ns(ns_per_tick);
+    int nstages = atomic_load(&prof_nstages);
+    int nthreads = atomic_load(&prof_nthreads);
+    if (nthreads > PROF_MAX_THREADS)
+        nthreads = PROF_MAX_THREADS;
+
+    uint64_t total_calls = 0;
+    for (int t = 0; t < nthreads; t++) {
+        for (int s = 0; s < nstages; s++)
+            total_calls += prof_threads[t].stage[s].calls;
+    }
+    double overhead = wall_ns > 0 ? 100.0 * total_calls * cost_ns / wall_ns : 0.0;
+
+    if (prof_mode == PROF_JSON) {
+        fprintf(stderr, "{\"wall_ms\": %.3f, \"overhead_pct\": %.3f, \"stages\": [", wall_ns / 1e6, overhead);
+        int first = 1;
+        for (int t = 0; t < nthreads; t++) {
+            const prof_thread *th = &prof_threads[t];
+            for (int s = 0; s < nstages; s++) {
+                const prof_stage *st = &th->stage[s];
+                if (!st->calls && !st->samples && !st->frames && !st->bytes && !st->allocs)
+                    continue;
+                fprintf(stderr,
+                        "%s\n  {\"thread\": %d, \"thread_name\": \"%s\", \"stage\": \"%s\", \"calls\": %llu, "
+                        "\"ms\": %.3f, \"samples\": %llu, \"frames\": %llu, \"bytes\": %llu, \"allocs\": %llu}",
+                        first ? "" : ",", t, th->name ? th->name : "", prof_names[s],
+                        (unsigned long long)st->calls, st->ticks * ns_per_tick / 1e6,
+                        (unsigned long long)st->samples, (unsigned long long)st->frames,
+                        (unsigned long long)st->bytes, (unsigned long long)st->allocs);
+                first = 0;
+            }
+        }
+        fprintf(stderr, "\n]}\n");
+        return;
+    }
+
+    fprintf(stderr, "---- 処理段ごとの内訳（全体 %.3f ms）----\n", wall_ns / 1e6);
+    fprintf(stderr, "%-3s %-10s %-16s %8s %11s %6s %10s %8s %10s %6s\n",
+            "thr", "name", "stage", "calls", "ms", "%", "samples", "frames", "bytes", "allocs");
+    for (int t = 0; t < nthreads; t++) {
+        const prof_thread *th = &prof_threads[t];
+        for (int s = 0; s < nstages; s++) {
+            const prof_stage *st = &th->stage[s];
+            if (!st->calls && !st->samples && !st->frames && !st->bytes && !st->allocs)
+                continue;
+            double ms = st->ticks * ns_per_tick / 1e6;
+            fprintf(stderr, "%-3d %-10s %-16s %8llu %11.3f %6.1f %10llu %8llu %10llu %6llu\n",
+                    t, th->name ? th->name : "-", prof_names[s], (unsigned long long)st->calls, ms,
+                    wall_ns > 0 ? 100.0 * ms * 1e6 / wall_ns : 0.0,
+                    (unsigned long long)st->samples, (unsigned long long)st->frames,
+                    (unsigned long long)st->bytes, (unsigned long long)st->allocs);
+        }
+    }
+    fprintf(stderr, "計測オーバーヘッド推定: %.3f%%（%.1f ns/回 × %llu 回）\n",
+            overhead, cost_ns, (unsigned long long)total_calls);
+}
+
+/**
+ * @brief 計測を初期化する
+ *
+ * 環境変数 AUDIO_PROF と引数 --prof[=json] を調べ、後者は argv から取り除く。
+ * 計測が有効なら終了時に prof_report が呼ばれるよう atexit に登録する。
+ */
+static inline void prof_init(int *argc, char **argv)
+{
+    prof_mode = prof_parse_args(argc, argv);
+    if (prof_mode != PROF_OFF) {
+        prof_tick0 = prof_now();
+        prof_ns0 = prof_now_ns();
+        prof_thread_name("main");
+        atexit(prof_report);
+    }
+}
+
+#endif // PROF_DISABLE
+
+#endif // PROF_H
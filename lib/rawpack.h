@@ -0,0 +1,207 @@
+#ifndef RAWPACK_H
+#define RAWPACK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * 多数の短い .raw（16bit PCM）を1つにまとめたアーカイブ（.pack）
+ *
+ *   [ヘッダ 64B][索引 64B × count][パディング][クリップ0][クリップ1]...
+ *
+ * 索引には元ファイル名から読み取った 話者・母音・番号 と、
+ * クリップの位置（ファイル先頭からのバイト数）・サンプル数を入れる。
+ * データ部は4096バイト境界から始まり、各クリップは64バイト境界にそろえる。
+ * 読み込み側はファイル全体を mmap するので、クリップごとのシステムコールはない。
+ * 作成は tools/rawpack.c で行う。
+ */
+
+#define RAWPACK_MAGIC "RAWPACK1"
+#define RAWPACK_DATA_ALIGN 4096 // データ部の先頭
+#define RAWPACK_CLIP_ALIGN 64   // 各クリップの先頭
+
+typedef struct {
+    char magic[8];          // RAWPACK_MAGIC
+    uint32_t count;         // クリップ数
+    uint32_t sampling_rate;
+    uint64_t index_offset;  // 索引の位置
+    uint64_t data_offset;   // データ部の位置
+    uint8_t reserved[32];
+} rawpack_header;
+
+typedef struct {
+    char name[32];    // 元のファイル名（拡張子なし）
+    char speaker[8];  // "f01" など（data/ の形式では空）
+    char vowel[4];    // "a" など（読み取れなければ空）
+    int32_t take;     // 番号（読み取れなければ -1）
+    uint32_t samples; // サンプル数
+    uint32_t reserved;
+    uint64_t offset;  // ファイル先頭からのバイト位置
+} rawpack_entry;
+
+_Static_assert(sizeof(rawpack_header) == 64, "rawpack_header は64バイト");
+_Static_assert(sizeof(rawpack_entry) == 64, "rawpack_entry は64バイト");
+
+/**
+ * @brief ファイル名から 話者・母音・番号 を読み取って索引に入れる
+ *
+ * 対応する名前:
+ *   data2 形式  f01a1.raw → 話者 "f01", 母音 "a", 番号 1
+ *   data  形式  a00.raw   → 話者 "",    母音 "a", 番号 0
+ * それ以外は名前だけを入れる。
+ * @return 成功なら0、名前（拡張子なし）が31文字を超えて切り詰めたなら-1
+ */
+static inline int rawpack_parse_name(const char *path, rawpack_entry *e)
+{
+    const char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    size_t len = strlen(base);
+    if (len > 4 && strcmp(base + len - 4, ".raw") == 0)
+        len -= 4;
+    int truncated = 0;
+    if (len >= sizeof(e->name)) {
+        len = sizeof(e->name) - 1;
+        truncated = 1;
+    }
+
+    memset(e->name, 0, sizeof(e->name));
+    memset(e->speaker, 0, sizeof(e->speaker));
+    memset(e->vowel, 0, sizeof(e->vowel));
+    memcpy(e->name, base, len);
+    e->take = -1;
+
+    const char *s = e->name;
+    if (len >= 5 && isalpha((unsigned char)s[0]) && isdigit((unsigned char)s[1]) &&
+        isdigit((unsigned char)s[2]) && isalpha((unsigned char)s[3]) && isdigit((unsigned char)s[4])) {
+        memcpy(e->speaker, s, 3);
+        e->vowel[0] = s[3];
+        e->take = atoi(s + 4);
+    } else if (len >= 2 && isalpha((unsigned char)s[0]) && isdigit((unsigned char)s[1])) {
+        size_t i = 1;
+        while (i < len && isdigit((unsigned char)s[i]))
+            i++;
+        if (i == len) {
+            e->vowel[0] = s[0];
+            e->take = atoi(s + 1);
+        }
+    }
+    return truncated ? -1 : 0;
+}
+
+// 読み込み用に開いたアーカイブ
+typedef struct {
+    void *base;
+    size_t size;
+    const rawpack_header *header;
+    const rawpack_entry *entries;
+    uint32_t count;
+} rawpack;
+
+static inline void rawpack_close(rawpack *p)
+{
+    if (p->base)
+        munmap(p->base, p->size);
+    memset(p, 0, sizeof(*p));
+}
+
+// 固定長の文字列欄が NUL で終わっているか
+static inline int rawpack_terminated(const char *field, size_t size)
+{
+    return memchr(field, '\0', size) != NULL;
+}
+
+/**
+ * @brief アーカイブを mmap で開き、ヘッダと索引を検査する
+ *
+ * 索引がファイル内に収まり境界にそろっていること、各クリップがファイル内に収まること、
+ * 名前・話者・母音の欄が NUL で終わっていることを確かめる（加算のあふれも考慮する）。
+ * @return 成功なら0、失敗なら-1（理由は標準エラーに出す）
+ */
+static inline int rawpack_open(rawpack *p, const char *path)
+{
+    memset(p, 0, sizeof(*p));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(rawpack_header)) {
+        fprintf(stderr, "%s はアーカイブではありません\n", path);
+        close(fd);
+        return -1;
+    }
+    p->size = st.st_size;
+    p->base = mmap(NULL, p->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p->base == MAP_FAILED) {
+        p->base = NULL;
+        perror("mmap");
+        return -1;
+    }
+
+    p->header = (const rawpack_header *)p->base;
+    uint64_t index_offset = p->header->index_offset;
+    if (memcmp(p->header->magic, RAWPACK_MAGIC, 8) != 0 || index_offset < sizeof(rawpack_header) ||
+        index_offset % _Alignof(rawpack_entry) != 0 || index_offset > p->size ||
+        p->header->count > (p->size - index_offset) / sizeof(rawpack_entry)) {
+        fprintf(stderr, "%s はアーカイブではありません\n", path);
+        rawpack_close(p);
+        return -1;
+    }
+    p->count = p->header->count;
+    p->entries = (const rawpack_entry *)((const char *)p->base + p->header->index_offset);
+    for (uint32_t i = 0; i < p->count; i++) {
+        const rawpack_entry *e = &p->entries[i];
+        if (e->offset % 2 != 0 || e->offset > p->size ||
+            e->samples > (p->size - e->offset) / sizeof(int16_t) ||
+            !rawpack_terminated(e->name, sizeof(e->name)) ||
+            !rawpack_terminated(e->speaker, sizeof(e->speaker)) ||
+            !rawpack_terminated(e->vowel, sizeof(e->vowel))) {
+            fprintf(stderr, "%s の索引 %u（%.*s）が壊れています\n", path, i, (int)sizeof(e->name), e->name);
+            rawpack_close(p);
+            return -1;
+        }
+    }
+    madvise(p->base, p->size, MADV_WILLNEED);
+    return 0;
+}
+
+// i番目のクリップのサンプル列（アーカイブ内を直接指す）
+static inline const int16_t *rawpack_samples(const rawpack *p, uint32_t i)
+{
+    return (const int16_t *)((const char *)p->base + p->entries[i].offset);
+}
+
+/**
+ * @brief 話者・母音・番号で探す（話者 NULL は区別しない）
+ * @return 見つかった索引番号、なければ-1
+ */
+static inline int rawpack_find(const rawpack *p, const char *speaker, const char *vowel, int take)
+{
+    for (uint32_t i = 0; i < p->count; i++) {
+        const rawpack_entry *e = &p->entries[i];
+        if ((!speaker || strcmp(e->speaker, speaker) == 0) && strcmp(e->vowel, vowel) == 0 && e->take == take)
+            return (int)i;
+    }
+    return -1;
+}
+
+// 名前（拡張子なし）で探す
+static inline int rawpack_find_name(const rawpack *p, const char *name)
+{
+    for (uint32_t i = 0; i < p->count; i++) {
+        if (strcmp(p->entries[i].name, name) == 0)
+            return (int)i;
+    }
+    return -1;
+}
+
+#endif // RAWPACK_H
@@ -0,0 +1,148 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * @brief fork-join 型のスレッドプール
+ *
+ * thread_pool_run(pool, fn, arg) は fn(arg, id, nthreads) を
+ * id = 0 .. nthreads-1 で同時に実行し、全員が終わるまで待つ。
+ * id = 0 は呼び出し元スレッド自身が受け持つので、ワーカーは nthreads-1 本。
+ */
+typedef void (*thread_pool_fn)(void *arg, int id, int nthreads);
+
+typedef struct {
+    int nthreads;
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    thread_pool_fn fn;
+    void *arg;
+    unsigned long generation; // run のたびに1増える
+    int remaining;            // 実行中のワーカー数
+    int shutdown;
+} thread_pool;
+
+typedef struct {
+    thread_pool *pool;
+    int id;
+} thread_pool_worker;
+
+static inline void *thread_pool_main(void *p)
+{
+    thread_pool_worker *w = (thread_pool_worker *)p;
+    thread_pool *pool = w->pool;
+    int id = w->id;
+    free(w);
+
+    unsigned long seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->shutdown)
+            pthread_cond_wait(&pool->start, &pool->lock);
+        if (pool->shutdown) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        thread_pool_fn fn = pool->fn;
+        void *arg = pool->arg;
+        pthread_mutex_unlock(&pool->lock);
+
+        fn(arg, id, pool->nthreads);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->remaining == 0)
+            pthread_cond_signal(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+// 使えるコア数
+static inline int thread_pool_default_size(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+/**
+ * @brief スレッドプールを作る
+ * @param nthreads スレッド数（呼び出し元を含む。0以下ならコア数）
+ * @return 失敗時は NULL
+ */
+static inline thread_pool *thread_pool_create(int nthreads)
+{
+    if (nthreads <= 0)
+        nthreads = thread_pool_default_size();
+    thread_pool *pool = (thread_pool *)calloc(1, sizeof(thread_pool));
+    if (!pool)
+        return NULL;
+    pool->nthreads = nthreads;
+    pool->threads = (pthread_t *)calloc(nthreads, sizeof(pthread_t));
+    if (!pool->threads) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (int i = 1; i < nthreads; i++) {
+        thread_pool_worker *w = (thread_pool_worker *)malloc(sizeof(thread_pool_worker));
+        if (w) {
+            w->pool = pool;
+            w->id = i;
+        }
+        if (!w || pthread_create(&pool->threads[i], NULL, thread_pool_main, w) != 0) {
+            free(w);
+            pool->nthreads = i; // 作れた分だけで動かす
+            break;
+        }
+    }
+    return pool;
+}
+
+static inline void thread_pool_run(thread_pool *pool, thread_pool_fn fn, void *arg)
+{
+    if (pool->nthreads == 1) {
+        fn(arg, 0, 1);
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->arg = arg;
+    pool->remaining = pool->nthreads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    fn(arg, 0, pool->nthreads);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->remaining > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static inline void thread_pool_destroy(thread_pool *pool)
+{
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 1; i < pool->nthreads; i++)
+        pthread_join(pool->threads[i], NULL);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    free(pool->threads);
+    free(pool);
+}
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,111 @@
+// 1024点FFTの速度比較（固定長版 / 汎用版 / 課題3のDFT）
+// 固定長版と汎用版は同じ本体（lib/fft_radix2.h）を使い、どちらも回転因子はテーブル参照。
+// 差は テーブルがコンパイル時定数か・長さが定数か だけになる。
+// コンパイル: gcc -O2 bench_fft.c -o bench_fft -lm
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "../lib/fft_fixed.h"
+#include "../課題3/kadai3_DFT_IDFT.h"
+
+#define N 1024
+#define REPEAT 4000 // 1試行あたりの回数
+#define TRIALS 5     // 試行回数（最速の試行を採る）
+#define DFT_REPEAT 5
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// テスト信号（2つの正弦波＋直流）
+static void make_signal(double *xr, double *xi)
+{
+    for (int n = 0; n < N; n++)
+    {
+        xr[n] = 0.3 + sin(2 * M_PI * 37 * n / N) + 0.5 * cos(2 * M_PI * 200 * n / N);
+        xi[n] = 0.0;
+    }
+}
+
+int main(void)
+{
+    static double ref_r[N], ref_i[N], xr[N], xi[N];
+    static float fr[N], fi[N];
+    double sink = 0.0;
+
+    // 精度確認: 課題3のDFTを基準とする
+    make_signal(ref_r, ref_i);
+    DFT(N, ref_r, ref_i);
+
+    make_signal(xr, xi);
+    fft1024(xr, xi);
+    double err_fixed = 0.0;
+    for (int k = 0; k < N; k++)
+        err_fixed = fmax(err_fixed, hypot(xr[k] - ref_r[k], xi[k] - ref_i[k]));
+
+    make_signal(xr, xi);
+    fft_runtime(N, xr, xi, 0);
+    double err_runtime = 0.0;
+    for (int k = 0; k < N; k++)
+        err_runtime = fmax(err_runtime, hypot(xr[k] - ref_r[k], xi[k] - ref_i[k]));
+
+    printf("最大誤差（DFT比）: 固定長 %.3e / 汎用 %.3e\n", err_fixed, err_runtime);
+
+    // 速度計測（順変換と逆変換を交互に掛けて値が発散しないようにする）
+    // 他のプロセスの影響を避けるため、TRIALS 回測って最速の値を採る
+    double t_fixed = 1e9, t_runtime = 1e9, t_fixed_f = 1e9;
+    for (int trial = 0; trial < TRIALS; trial++)
+    {
+        make_signal(xr, xi);
+        double t0 = now_sec();
+        for (int r = 0; r < REPEAT; r++)
+        {
+            fft1024(xr, xi);
+            fft1024_inverse(xr, xi);
+        }
+        t_fixed = fmin(t_fixed, (now_sec() - t0) / (2.0 * REPEAT));
+        sink += xr[1];
+
+        make_signal(xr, xi);
+        t0 = now_sec();
+        for (int r = 0; r < REPEAT; r++)
+        {
+            fft_runtime(N, xr, xi, 0);
+            fft_runtime(N, xr, xi, 1);
+        }
+        t_runtime = fmin(t_runtime, (now_sec() - t0) / (2.0 * REPEAT));
+        sink += xr[1];
+
+        for (int n = 0; n < N; n++)
+        {
+            fr[n] = (float)xr[n];
+            fi[n] = 0.0f;
+        }
+        t0 = now_sec();
+        for (int r = 0; r < REPEAT; r++)
+        {
+            fft1024f(fr, fi);
+            fft1024f_inverse(fr, fi);
+        }
+        t_fixed_f = fmin(t_fixed_f, (now_sec() - t0) / (2.0 * REPEAT));
+        sink += fr[1];
+    }
+
+    make_signal(xr, xi);
+    double t0 = now_sec();
+    for (int r = 0; r < DFT_REPEAT; r++)
+        DFT(N, xr, xi);
+    double t_dft = (now_sec() - t0) / DFT_REPEAT;
+    sink += xr[1];
+
+    printf("固定長FFT (double): %8.2f us/回\n", t_fixed * 1e6);
+    printf("固定長FFT (float) : %8.2f us/回\n", t_fixed_f * 1e6);
+    printf("汎用FFT   (double): %8.2f us/回（固定長の %.2f 倍）\n", t_runtime * 1e6, t_runtime / t_fixed);
+    printf("課題3 DFT (double): %8.2f us/回（固定長の %.0f 倍）\n", t_dft * 1e6, t_dft / t_fixed);
+    printf("(checksum %g)\n", sink);
+    return 0;
+}
@@ -0,0 +1,125 @@
+// six-step FFT（lib/fft_large.h）の精度確認とスレッド数ごとの速度比較
+// スレッド数は 1, 2, 4, ... とコア数。どのスレッド数でも 順変換（基数2 FFT との差）と
+// 逆変換（順変換→逆変換で元に戻るか）の誤差を確かめる。
+// コンパイル: gcc -O2 bench_fft_large.c -o bench_fft_large -lm -lpthread
+// 使い方: ./bench_fft_large [最大の2のべき指数（既定22、最大24）]
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include "../lib/fft_large.h"
+#include "../lib/fft_fixed.h"
+
+#define MIN_LOG2 16
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// 1, 2, 4, ... と倍にしていき、最後は必ずコア数を測る
+static int next_threads(int t, int cores)
+{
+    if (t >= cores)
+        return cores + 1;
+    return (t * 2 < cores) ? t * 2 : cores;
+}
+
+// 最大振幅に対する相対誤差
+static double rel_error(int n, const double *re, const double *im, const double *ref_re, const double *ref_im)
+{
+    double err = 0.0, mag = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        err = fmax(err, hypot(re[i] - ref_re[i], im[i] - ref_im[i]));
+        mag = fmax(mag, hypot(ref_re[i], ref_im[i]));
+    }
+    return err / mag;
+}
+
+static void make_signal(int n, double *re, double *im)
+{
+    srand(1);
+    for (int i = 0; i < n; i++)
+    {
+        re[i] = (double)rand() / RAND_MAX - 0.5;
+        im[i] = 0.0;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int max_log2 = (argc > 1) ? atoi(argv[1]) : 22;
+    if (max_log2 < MIN_LOG2 || max_log2 > 24)
+    {
+        fprintf(stderr, "使い方: %s [最大の2のべき指数 %d〜24]\n", argv[0], MIN_LOG2);
+        return 1;
+    }
+    int cores = thread_pool_default_size();
+
+    printf("%-6s %8s %12s %12s %10s\n", "N", "threads", "fwd_err", "inv_err", "ms/回");
+
+    for (int lg = MIN_LOG2; lg <= max_log2; lg++)
+    {
+        int n = 1 << lg;
+        double *re = fft_large_alloc(n), *im = fft_large_alloc(n);
+        double *ref_re = fft_large_alloc(n), *ref_im = fft_large_alloc(n);
+        double *x_re = fft_large_alloc(n), *x_im = fft_large_alloc(n);
+        if (!re || !im || !ref_re || !ref_im || !x_re || !x_im)
+        {
+            fprintf(stderr, "メモリ確保に失敗しました（N = 2^%d）\n", lg);
+            return 1;
+        }
+        make_signal(n, x_re, x_im);
+
+        // 基準: 課題4/7でも使う基数2 FFT（汎用版）。1回目はテーブル作成を含むので捨てる
+        memcpy(ref_re, x_re, n * sizeof(double));
+        memcpy(ref_im, x_im, n * sizeof(double));
+        fft_runtime(n, ref_re, ref_im, 0);
+        memcpy(ref_re, x_re, n * sizeof(double));
+        memcpy(ref_im, x_im, n * sizeof(double));
+        double t0 = now_sec();
+        fft_runtime(n, ref_re, ref_im, 0);
+        printf("2^%-4d %8s %12s %12s %10.2f\n", lg, "radix2", "-", "-", (now_sec() - t0) * 1e3);
+
+        for (int t = 1; t <= cores; t = next_threads(t, cores))
+        {
+            fft_large_plan *p = fft_large_plan_create(n, t);
+            if (!p)
+            {
+                fprintf(stderr, "計画の作成に失敗しました（N = 2^%d）\n", lg);
+                return 1;
+            }
+            // 精度: 順変換は基準と、逆変換は元の信号と比べる（1回目はページ確保も兼ねる）
+            memcpy(re, x_re, n * sizeof(double));
+            memcpy(im, x_im, n * sizeof(double));
+            fft_large(p, re, im, 0);
+            double fwd_err = rel_error(n, re, im, ref_re, ref_im);
+            fft_large(p, re, im, 1);
+            double inv_err = rel_error(n, re, im, x_re, x_im);
+
+            int reps = (lg <= 20) ? 5 : 2;
+            t0 = now_sec();
+            for (int r = 0; r < reps; r++)
+            {
+                fft_large(p, re, im, 0);
+                fft_large(p, re, im, 1);
+            }
+            printf("2^%-4d %8d %12.1e %12.1e %10.2f\n", lg, t, fwd_err, inv_err,
+                   (now_sec() - t0) / (2 * reps) * 1e3);
+            fft_large_plan_destroy(p);
+        }
+
+        free(re);
+        free(im);
+        free(ref_re);
+        free(ref_im);
+        free(x_re);
+        free(x_im);
+    }
+    printf("（誤差は最大振幅に対する相対値）\n");
+    return 0;
+}
@@ -0,0 +1,166 @@
+// 低域通過フィルタの比較: 課題5のFIR（窓なし sinc, N=100/500/1000）と IIR（lib/iir.h）
+// 1サンプルあたりの処理時間・積和回数と、理想低域フィルタからの振幅特性の誤差を表示する
+// コンパイル: gcc -O2 bench_iir.c -o bench_iir -lm
+// 使い方: ./bench_iir
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <complex.h>
+#include "../lib/iir.h"
+#include "../課題6/shift.h"
+#include "../課題6/conv.h"
+
+#define OMEGA_C 0.4    // 課題5と同じ正規化カットオフ周波数
+#define PASS_EDGE 0.35 // 誤差を測る通過域 [0, PASS_EDGE]
+#define STOP_EDGE 0.45 // 誤差を測る阻止域 [STOP_EDGE, 1]
+#define GRID 4096      // 振幅特性を調べる周波数点数
+#define LEN 16000      // 処理時間を測る信号長（1秒分）
+#define MAX_N 1000
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// 課題5と同じ設計式（N+1タップ）
+static int design_fir(int N, double *h)
+{
+    for (int n = 0; n <= N; n++)
+    {
+        if (n == N / 2)
+            h[n] = OMEGA_C;
+        else
+            h[n] = sin((n - N / 2.0) * M_PI * OMEGA_C) / ((n - N / 2.0) * M_PI);
+    }
+    return N + 1;
+}
+
+static double fir_magnitude(const double *h, int tap, double w)
+{
+    double complex H = 0.0;
+    for (int n = 0; n < tap; n++)
+        H += h[n] * cexp(-I * M_PI * w * n);
+    return cabs(H);
+}
+
+typedef struct {
+    const double *h;
+    int tap;
+    const iir_cascade *iir;
+} filter;
+
+static double magnitude(const filter *f, double w)
+{
+    return f->iir ? iir_magnitude(f->iir, w) : fir_magnitude(f->h, f->tap, w);
+}
+
+// 通過域の最大偏差 [dB] と 阻止域の最大利得 [dB]
+static void response_error(const filter *f, double *pass_db, double *stop_db)
+{
+    *pass_db = 0.0;
+    *stop_db = -400.0;
+    for (int k = 0; k <= GRID; k++)
+    {
+        double w = (double)k / GRID;
+        double db = 20.0 * log10(magnitude(f, w) + 1e-20);
+        if (w <= PASS_EDGE)
+            *pass_db = fmax(*pass_db, fabs(db));
+        else if (w >= STOP_EDGE)
+            *stop_db = fmax(*stop_db, db);
+    }
+}
+
+// 課題6と同じ1サンプルずつの shift + conv
+static void run_fir(const filter *f, const double *in, double *out, int n)
+{
+    static double x[MAX_N + 1];
+    for (int i = 0; i < f->tap; i++)
+        x[i] = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        shift(in[i], x, f->tap);
+        out[i] = conv((double *)f->h, x, f->tap);
+    }
+}
+
+// 1サンプルあたりの処理時間 [ns]（合計0.2秒以上になるまで繰り返す）
+static double time_per_sample(const filter *f, const double *in, double *out)
+{
+    int repeat = 0;
+    double t0 = now_sec(), t;
+    do
+    {
+        if (f->iir)
+        {
+            iir_cascade c = *f->iir;
+            iir_reset(&c);
+            for (int i = 0; i < LEN; i += 1024) // 課題6と同じ1024サンプルのブロック
+                iir_process(&c, in + i, out + i, (LEN - i < 1024) ? LEN - i : 1024);
+        }
+        else
+        {
+            run_fir(f, in, out, LEN);
+        }
+        repeat++;
+        t = now_sec() - t0;
+    } while (t < 0.2);
+    return t / ((double)repeat * LEN) * 1e9;
+}
+
+static void report(const char *name, const filter *f, const double *in, double *out)
+{
+    double pass_db, stop_db;
+    response_error(f, &pass_db, &stop_db);
+    int macs = f->iir ? 5 * f->iir->sections : f->tap;
+    double ns = time_per_sample(f, in, out);
+    printf("%-14s %8d %10.2f %12.3f %12.1f\n", name, macs, ns, pass_db, stop_db);
+}
+
+int main(void)
+{
+    static double h[MAX_N + 1];
+    double *in = malloc(sizeof(double) * LEN);
+    double *out = malloc(sizeof(double) * LEN);
+    if (!in || !out)
+    {
+        fprintf(stderr, "メモリ確保に失敗しました\n");
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < LEN; i++)
+        in[i] = (double)rand() / RAND_MAX - 0.5;
+
+    printf("理想低域フィルタ（遮断 %.2f）との比較: 通過域 [0, %.2f] の最大偏差、阻止域 [%.2f, 1] の最大利得\n",
+           OMEGA_C, PASS_EDGE, STOP_EDGE);
+    printf("%-14s %8s %10s %12s %12s\n", "filter", "MAC/pt", "ns/pt", "pass[dB]", "stop[dB]");
+
+    const int fir_n[] = {100, 500, 1000};
+    for (int k = 0; k < 3; k++)
+    {
+        char name[32];
+        filter f = {h, design_fir(fir_n[k], h), NULL};
+        snprintf(name, sizeof(name), "FIR N=%d", fir_n[k]);
+        report(name, &f, in, out);
+    }
+
+    // IIRは課題6の -iir と同じ設計条件（通過域リップル 1dB、阻止域 60dB）
+    const struct { const char *name; int order; } iir_list[] = {
+        {"butter", 8}, {"butter", 16}, {"cheby1", 8}, {"ellip", 4}, {"ellip", 6}, {"ellip", 8},
+    };
+    for (size_t k = 0; k < sizeof(iir_list) / sizeof(iir_list[0]); k++)
+    {
+        char name[32];
+        iir_cascade c;
+        iir_design(&c, iir_type_from_name(iir_list[k].name), IIR_LOWPASS, iir_list[k].order, OMEGA_C, 1.0, 60.0);
+        filter f = {NULL, 0, &c};
+        snprintf(name, sizeof(name), "%s:%d", iir_list[k].name, iir_list[k].order);
+        report(name, &f, in, out);
+    }
+
+    free(in);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,41 @@
+#!/bin/bash
+# pipeline（1プロセス・段ごとスレッド）と、従来の
+# kadai1 → kadai6 → kadai4 → kadai7 を .raw ファイル経由でつなぐ方法の実行時間を比べる
+# 条件をそろえるため、ファイル経由の側も信号全体のテキスト出力は省く
+# （kadai1 は出力.txt に -、kadai6 は入出力を指定すると mix.txt / filtered.txt を書かない）
+# 使い方: ./bench_pipeline.sh [入力.raw] [繰り返し回数]
+# （tools/ で実行すること。テンプレートと係数は ../data, ../課題５ から読む）
+set -e
+
+INPUT=$(cd "$(dirname "${1:-../data3/sentence1.raw}")" && pwd)/$(basename "${1:-../data3/sentence1.raw}")
+REPEAT=${2:-5}
+COEFF=$(cd ../課題５ && pwd)/fir_coeff_N100.txt
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+gcc -O2 ../課題1/kadai1.c -o "$WORK/kadai1"
+gcc -O2 ../課題6/kadai6.c -o "$WORK/kadai6" -lm
+gcc -O2 ../課題４/kadai4.c -o "$WORK/kadai4" -lm -lpthread
+gcc -O2 ../課題7/kadai7.c -o "$WORK/kadai7" -lm
+gcc -O2 pipeline.c -o "$WORK/pipeline" -lm -lpthread
+
+TIMEFORMAT=%R
+
+echo "入力: $INPUT（$(($(wc -c < "$INPUT") / 2)) サンプル）, $REPEAT 回"
+
+echo "-- ファイル経由（kadai1 → kadai6 → kadai4 → kadai7）[秒]"
+time (
+    for ((i = 0; i < REPEAT; i++)); do
+        (cd "$WORK" && ./kadai1 "$INPUT" - loud3.raw loud30.raw && \
+            ./kadai6 loud3.raw filtered.raw "$COEFF" && \
+            ./kadai4 filtered.raw spectrum.txt) > /dev/null
+        (cd ../課題7 && "$WORK/kadai7" "$WORK/filtered.raw") > /dev/null
+    done
+)
+
+echo "-- pipeline（全フレームのSTFTと識別を含む）[秒]"
+time (
+    for ((i = 0; i < REPEAT; i++)); do
+        "$WORK/pipeline" -g 3 -c "$COEFF" "$INPUT" "$WORK/pipeline.txt" > /dev/null
+    done
+)
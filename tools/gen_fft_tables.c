@@ -0,0 +1,98 @@
+// 固定長FFT用のテーブル（回転因子・ビット反転・ハミング窓）をヘッダとして生成する
+// 使い方: ./gen_fft_tables 1024 > ../lib/fft_tables_1024.h
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// テーブルを「{ v0, v1, ... }」形式のマクロとして出力
+static void emit_double_table(const char *name, int n, const double *v)
+{
+    printf("#define %s \\\n    { \\\n", name);
+    for (int i = 0; i < n; i++)
+    {
+        printf("%s%.17g%s", (i % 4 == 0) ? "        " : " ", v[i], (i == n - 1) ? "" : ",");
+        if (i % 4 == 3 || i == n - 1)
+            printf(" \\\n");
+    }
+    printf("    }\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "使い方: %s FFT長(2のべき乗)\n", argv[0]);
+        return 1;
+    }
+
+    int n = atoi(argv[1]);
+    int log2n = 0;
+    while ((1 << log2n) < n)
+        log2n++;
+    if (n < 4 || n > 65536 || (1 << log2n) != n)
+    {
+        fprintf(stderr, "FFT長は4〜65536の2のべき乗にしてください\n");
+        return 1;
+    }
+
+    double *cos_tab = (double *)malloc(sizeof(double) * n / 2);
+    double *sin_tab = (double *)malloc(sizeof(double) * n / 2);
+    double *window = (double *)malloc(sizeof(double) * n);
+    if (!cos_tab || !sin_tab || !window)
+    {
+        fprintf(stderr, "メモリ確保に失敗しました\n");
+        return 1;
+    }
+
+    for (int k = 0; k < n / 2; k++)
+    {
+        cos_tab[k] = cos(2.0 * M_PI * k / n);
+        sin_tab[k] = sin(2.0 * M_PI * k / n);
+    }
+    for (int i = 0; i < n; i++)
+    {
+        window[i] = 0.54 - 0.46 * cos(2.0 * M_PI * i / (n - 1));
+    }
+
+    printf("// このファイルは tools/gen_fft_tables.c で生成（手で編集しないこと）\n");
+    printf("// 使い方: ./gen_fft_tables %d > fft_tables_%d.h\n", n, n);
+    printf("#ifndef FFT_TABLES_%d_H\n#define FFT_TABLES_%d_H\n\n", n, n);
+
+    // cos(2πk/N), sin(2πk/N)  (k = 0 .. N/2-1)
+    char name[64];
+    snprintf(name, sizeof(name), "FFT_TABLE_%d_COS", n);
+    emit_double_table(name, n / 2, cos_tab);
+    snprintf(name, sizeof(name), "FFT_TABLE_%d_SIN", n);
+    emit_double_table(name, n / 2, sin_tab);
+
+    // ビット反転順序
+    printf("#define FFT_TABLE_%d_REV \\\n    { \\\n", n);
+    for (int i = 0; i < n; i++)
+    {
+        int r = 0;
+        for (int b = 0; b < log2n; b++)
+        {
+            if (i & (1 << b))
+                r |= 1 << (log2n - 1 - b);
+        }
+        printf("%s%d%s", (i % 16 == 0) ? "        " : " ", r, (i == n - 1) ? "" : ",");
+        if (i % 16 == 15 || i == n - 1)
+            printf(" \\\n");
+    }
+    printf("    }\n\n");
+
+    // ハミング窓（長さN）
+    snprintf(name, sizeof(name), "FFT_TABLE_%d_HAMMING", n);
+    emit_double_table(name, n, window);
+
+    printf("#endif // FFT_TABLES_%d_H\n", n);
+
+    free(cos_tab);
+    free(sin_tab);
+    free(window);
+    return 0;
+}
@@ -0,0 +1,412 @@
+// 増幅 → FIRフィルタ → 短時間スペクトル → 母音識別 を1プロセスで流す
+// 各段は別スレッドで動き、有界キューでブロックのポインタだけを受け渡す。
+// ディスクへの入出力は先頭（読み込み）と末尾（書き出し）の段だけで行う。
+//
+// コンパイル: gcc -O2 pipeline.c -o pipeline -lm -lpthread
+// 使い方: ./pipeline [-g 倍率] [-c 係数ファイル] [-s スペクトル.txt] 入力.raw 出力.txt
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "../lib/fft_fixed.h"
+#include "../lib/block_queue.h"
+#include "../lib/prof.h"
+
+#define SAMPLING_RATE 16000
+#define FRAME 1024        // 分析フレーム長（fft1024）
+#define HOP 512           // フレームシフト = 1ブロックのサンプル数
+#define MAX_TAP 1024      // FIR係数の最大数
+#define QUEUE_DEPTH 4     // 段間キューの深さ
+#define NUM_STAGES 6      // read, gain, fir, stft, classify, write
+#define NUM_BLOCKS (QUEUE_DEPTH * (NUM_STAGES - 1) + NUM_STAGES + 2) // 詰まらない最小数
+#define NUM_VOWELS 5
+
+#define DEFAULT_GAIN 3.0
+#define DEFAULT_COEFF_FILE "../課題５/fir_coeff_N100.txt"
+
+const char *vowel_labels[NUM_VOWELS] = {"a", "i", "u", "e", "o"};
+const char *template_files[NUM_VOWELS] = {
+    "../data/a00.raw", "../data/i00.raw", "../data/u00.raw", "../data/e00.raw", "../data/o00.raw"};
+
+// 段間で受け渡すブロック（サンプル列にもスペクトルにも使う）
+typedef struct
+{
+    long start;     // 先頭サンプルの位置
+    int n;          // 有効なサンプル数
+    int label;      // 識別結果（classify段が設定）
+    double distance;
+    double energy_db;
+    double re[FRAME];
+    double im[FRAME];
+} block;
+
+// 演算子: ブロックを受け取り、次段に渡すブロックを返す（NULLなら何も渡さない）
+// ブロックをまたいで持ち越す値は state に置くので、同じ演算子を複数の段に使ってもよい
+typedef struct stage
+{
+    const char *name;
+    block *(*process)(struct stage *st, block *b);
+    void *state; // 演算子ごとの状態（なければ NULL）
+    block_queue *in;
+    block_queue *out;
+} stage;
+
+// FIR段の状態: 係数と、直前 tap-1 サンプルの履歴
+typedef struct
+{
+    const double *h;
+    int tap;
+    double hist[MAX_TAP - 1 + HOP];
+} fir_state;
+
+// STFT段の状態: 次のフレームの前半になるブロック
+typedef struct
+{
+    block *prev;
+} stft_state;
+
+static block_queue free_blocks; // 使い終わったブロックの置き場
+static FILE *fp_in, *fp_out, *fp_spec;
+static double gain = DEFAULT_GAIN;
+static double templates[NUM_VOWELS][FRAME];
+
+static void recycle(block *b)
+{
+    block_queue_push(&free_blocks, b);
+}
+
+// ---- 演算子 ----
+
+// 飽和つき増幅（課題1）
+static block *op_gain(stage *st, block *b)
+{
+    (void)st;
+    PROF_BEGIN(gain);
+    for (int i = 0; i < b->n; i++)
+    {
+        double v = b->re[i] * gain;
+        if (v > 32767.0 / 32768.0)
+            v = 32767.0 / 32768.0;
+        if (v < -1.0)
+            v = -1.0;
+        b->re[i] = v;
+    }
+    PROF_END(gain);
+    PROF_COUNT(gain, samples, b->n);
+    return b;
+}
+
+// FIRフィルタ（課題6）: 直前 tap-1 サンプルを履歴として持ち越す
+static block *op_fir(stage *st, block *b)
+{
+    fir_state *fs = (fir_state *)st->state;
+    const double *h = fs->h;
+    const int tap = fs->tap;
+    double *hist = fs->hist;
+    PROF_BEGIN(conv);
+    for (int i = 0; i < b->n; i++)
+        hist[tap - 1 + i] = b->re[i];
+    for (int i = 0; i < b->n; i++)
+    {
+        const double *x = &hist[tap - 1 + i];
+        double y = 0.0;
+        for (int k = 0; k < tap; k++)
+            y += h[k] * x[-k];
+        if (y > 1.0)
+            y = 1.0;
+        if (y < -1.0)
+            y = -1.0;
+        b->re[i] = y;
+    }
+    memmove(hist, &hist[b->n], sizeof(double) * (tap - 1));
+    PROF_END(conv);
+    PROF_COUNT(conv, samples, b->n);
+    return b;
+}
+
+// 窓かけ＋FFTで対数パワースペクトルを求める（テンプレート作成と共用）
+static void log_power_spectrum(block *f)
+{
+    fft1024_apply_window(f->re);
+    for (int i = 0; i < FRAME; i++)
+        f->im[i] = 0.0;
+    fft1024(f->re, f->im);
+    for (int k = 0; k < FRAME; k++)
+        f->re[k] = log(f->re[k] * f->re[k] + f->im[k] * f->im[k] + 1e-10);
+}
+
+// 短時間スペクトル（課題4）: 前ブロックを保持しておき、その後半に新しいブロックの
+// HOP サンプルを書き足してフレームにする（前半はコピーしない）
+static block *op_stft(stage *st, block *b)
+{
+    stft_state *ss = (stft_state *)st->state;
+    block *f = ss->prev;
+    if (f)
+    {
+        PROF_BEGIN(stft);
+        f->n = FRAME;
+        double energy = 0.0;
+        for (int i = 0; i < HOP; i++)
+            f->re[HOP + i] = (i < b->n) ? b->re[i] : 0.0;
+        for (int i = 0; i < FRAME; i++)
+            energy += f->re[i] * f->re[i];
+        f->energy_db = 10.0 * log10(energy / FRAME + 1e-12);
+        log_power_spectrum(f);
+        PROF_END(stft);
+        PROF_COUNT(stft, frames, 1);
+    }
+    ss->prev = b;
+    if (b->n < HOP) // 末尾ブロック
+    {
+        recycle(b);
+        ss->prev = NULL;
+    }
+    return f;
+}
+
+// 母音識別（課題7）: テンプレートとのユークリッド距離が最小の母音
+static block *op_classify(stage *st, block *f)
+{
+    (void)st;
+    PROF_BEGIN(classify);
+    f->label = 0;
+    f->distance = INFINITY;
+    for (int v = 0; v < NUM_VOWELS; v++)
+    {
+        double sum = 0.0;
+        for (int k = 0; k < FRAME; k++)
+        {
+            double diff = f->re[k] - templates[v][k];
+            sum += diff * diff;
+        }
+        if (sqrt(sum) < f->distance)
+        {
+            f->distance = sqrt(sum);
+            f->label = v;
+        }
+    }
+    PROF_END(classify);
+    PROF_COUNT(classify, frames, 1);
+    return f;
+}
+
+// 書き出し段
+static block *op_write(stage *st, block *f)
+{
+    (void)st;
+    PROF_BEGIN(write_text);
+    double time_ms = (double)f->start * 1000 / SAMPLING_RATE;
+    fprintf(fp_out, "%.1f\t%s\t%.2f\t%.2f\n", time_ms, vowel_labels[f->label], f->distance, f->energy_db);
+    if (fp_spec)
+    {
+        for (int k = 0; k <= FRAME / 2; k++)
+            fprintf(fp_spec, "%.1f\t%.1f\t%.6f\n", time_ms, (double)k * SAMPLING_RATE / FRAME, f->re[k] / log(10.0));
+        fprintf(fp_spec, "\n");
+    }
+    PROF_END(write_text);
+    PROF_COUNT(write_text, frames, 1);
+    recycle(f);
+    return NULL;
+}
+
+// ---- スレッド ----
+
+// 読み込み段: 16bit PCM を HOP サンプルずつ正規化してブロックに詰める
+static void *read_thread(void *arg)
+{
+    stage *st = (stage *)arg;
+    prof_thread_name(st->name);
+    int16_t pcm[HOP];
+    long pos = 0;
+    for (;;)
+    {
+        block *b = (block *)block_queue_pop(&free_blocks);
+        PROF_BEGIN(read_pcm);
+        size_t count = fread(pcm, sizeof(int16_t), HOP, fp_in);
+        for (size_t i = 0; i < count; i++)
+            b->re[i] = pcm[i] / 32768.0;
+        PROF_END(read_pcm);
+        PROF_COUNT(read_pcm, samples, count);
+        PROF_COUNT(read_pcm, bytes, count * sizeof(int16_t));
+        b->start = pos;
+        b->n = (int)count;
+        pos += count;
+        if (count == 0)
+        {
+            recycle(b);
+            break;
+        }
+        block_queue_push(st->out, b);
+        if (count < HOP)
+            break;
+    }
+    block_queue_close(st->out);
+    return NULL;
+}
+
+// 演算子段: 入力キューが閉じるまで process を繰り返す
+static void *stage_thread(void *arg)
+{
+    stage *st = (stage *)arg;
+    prof_thread_name(st->name);
+    block *b;
+    while ((b = (block *)block_queue_pop(st->in)) != NULL)
+    {
+        block *out = st->process(st, b);
+        if (out && st->out)
+            block_queue_push(st->out, out);
+    }
+    if (st->out)
+        block_queue_close(st->out);
+    return NULL;
+}
+
+// ---- 準備 ----
+
+// フィルタ係数読み込み（課題6と同じ「番号 係数」形式）
+static int load_coefficients(const char *filename, double *coeff, int max_tap)
+{
+    FILE *fp = fopen(filename, "r");
+    if (!fp)
+    {
+        perror("係数ファイル読み込み失敗");
+        exit(1);
+    }
+    int n = 0;
+    while (n < max_tap && fscanf(fp, "%*d %lf", &coeff[n]) == 1)
+        n++;
+    fclose(fp);
+    return n;
+}
+
+// テンプレート（各母音ファイルの先頭 FRAME サンプル）の対数パワースペクトル
+static void load_templates(void)
+{
+    static block f;
+    for (int v = 0; v < NUM_VOWELS; v++)
+    {
+        FILE *fp = fopen(template_files[v], "rb");
+        if (!fp)
+        {
+            fprintf(stderr, "ファイル %s が開けません\n", template_files[v]);
+            exit(1);
+        }
+        int16_t pcm[FRAME];
+        if (fread(pcm, sizeof(int16_t), FRAME, fp) != FRAME)
+        {
+            fprintf(stderr, "ファイル %s の読み込みエラー\n", template_files[v]);
+            exit(1);
+        }
+        fclose(fp);
+        for (int i = 0; i < FRAME; i++)
+            f.re[i] = pcm[i] / 32768.0;
+        log_power_spectrum(&f);
+        memcpy(templates[v], f.re, sizeof(double) * FRAME);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    prof_init(&argc, argv);
+
+    const char *coeff_file = DEFAULT_COEFF_FILE;
+    const char *spec_file = NULL;
+    int opt, bad_option = 0;
+    while ((opt = getopt(argc, argv, "g:c:s:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'g':
+            gain = atof(optarg);
+            break;
+        case 'c':
+            coeff_file = optarg;
+            break;
+        case 's':
+            spec_file = optarg;
+            break;
+        default:
+            bad_option = 1;
+            break;
+        }
+    }
+    if (bad_option || argc - optind != 2)
+    {
+        fprintf(stderr, "使い方: %s [-g 倍率] [-c 係数ファイル] [-s スペクトル.txt] 入力.raw 出力.txt\n", argv[0]);
+        return 1;
+    }
+
+    static double h[MAX_TAP];
+    int tap = load_coefficients(coeff_file, h, MAX_TAP);
+    if (tap == 0)
+    {
+        fprintf(stderr, "係数ファイル %s に係数がありません\n", coeff_file);
+        return 1;
+    }
+    load_templates();
+
+    fp_in = fopen(argv[optind], "rb");
+    if (!fp_in)
+    {
+        perror("入力ファイルを開けません");
+        return 1;
+    }
+    fp_out = fopen(argv[optind + 1], "w");
+    if (!fp_out || (spec_file && !(fp_spec = fopen(spec_file, "w"))))
+    {
+        perror("出力ファイルを開けません");
+        return 1;
+    }
+
+    // ブロックはすべて最初に確保し、以後は使い回す
+    block *pool = (block *)calloc(NUM_BLOCKS, sizeof(block));
+    if (!pool || block_queue_init(&free_blocks, NUM_BLOCKS) != 0)
+    {
+        fprintf(stderr, "メモリ確保に失敗しました\n");
+        return 1;
+    }
+    PROF_COUNT(alloc, allocs, 1);
+    PROF_COUNT(alloc, bytes, NUM_BLOCKS * sizeof(block));
+    for (int i = 0; i < NUM_BLOCKS; i++)
+        block_queue_push(&free_blocks, &pool[i]);
+
+    block_queue queues[NUM_STAGES - 1];
+    for (int i = 0; i < NUM_STAGES - 1; i++)
+        block_queue_init(&queues[i], QUEUE_DEPTH);
+
+    static fir_state fir;
+    fir.h = h;
+    fir.tap = tap;
+    stft_state stft = {NULL};
+
+    stage stages[NUM_STAGES] = {
+        {"read", NULL, NULL, NULL, &queues[0]},
+        {"gain", op_gain, NULL, &queues[0], &queues[1]},
+        {"fir", op_fir, &fir, &queues[1], &queues[2]},
+        {"stft", op_stft, &stft, &queues[2], &queues[3]},
+        {"classify", op_classify, NULL, &queues[3], &queues[4]},
+        {"write", op_write, NULL, &queues[4], NULL},
+    };
+
+    pthread_t threads[NUM_STAGES];
+    pthread_create(&threads[0], NULL, read_thread, &stages[0]);
+    for (int i = 1; i < NUM_STAGES; i++)
+        pthread_create(&threads[i], NULL, stage_thread, &stages[i]);
+    for (int i = 0; i < NUM_STAGES; i++)
+        pthread_join(threads[i], NULL);
+
+    fclose(fp_in);
+    fclose(fp_out);
+    if (fp_spec)
+        fclose(fp_spec);
+    for (int i = 0; i < NUM_STAGES - 1; i++)
+        block_queue_destroy(&queues[i]);
+    block_queue_destroy(&free_blocks);
+    free(pool);
+
+    printf("出力完了: %s → %s\n", argv[optind], argv[optind + 1]);
+    return 0;
+}
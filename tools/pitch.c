@@ -0,0 +1,463 @@
+// 自己相関法による基本周波数（F0）推定
+// 自己相関は FFT → パワースペクトル → 逆FFT で求める（Wiener–Khinchin の定理）。
+// 窓の自己相関で割って窓の影響を補正し、ピークは放物線補間で求める。
+// ディレクトリを指定すると中の .raw をすべて処理し、話者ごとの平均も出す。
+// .pack（tools/rawpack で作るアーカイブ）を指定すると中のクリップをすべて処理する。
+//
+// コンパイル: gcc -O2 pitch.c -o pitch -lm -lpthread
+// 使い方: ./pitch [-o 出力ディレクトリ] [-j スレッド数] ファイル・ディレクトリ・アーカイブ ...
+//   例: ./pitch ../data2
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "../lib/fft_fixed.h"
+#include "../lib/fft_tables_2048.h"
+#include "../lib/thread_pool.h"
+#include "../lib/prof.h"
+#include "../lib/rawpack.h"
+
+#define SAMPLING_RATE 16000
+#define FRAME 1024      // 分析フレーム長（64 ms）
+#define FFT_SIZE 2048   // 巡回相関にならないよう 2倍にゼロ詰め
+#define HOP 160         // フレームシフト（10 ms）
+#define F0_MIN 60.0     // 探索範囲（Hz）
+#define F0_MAX 500.0
+#define VOICING 0.45    // 正規化自己相関がこれ以上なら有声
+#define SILENCE_DB -50.0 // これより小さいフレームは無音扱い（dBFS）
+#define MAX_FILES 4096
+#define MAX_PATH 512
+#define MAX_PACKS 16
+
+// 自己相関用の2048点FFT（テーブルはコンパイル時に埋め込み）
+FFT_FIXED_DEFINE(fft2048, double, FFT_SIZE, FFT_TABLE_2048_COS, FFT_TABLE_2048_SIN,
+                 FFT_TABLE_2048_REV, FFT_TABLE_2048_HAMMING)
+
+// 1ファイル分の結果
+typedef struct
+{
+    char path[MAX_PATH];
+    char name[32];     // 拡張子なしのファイル名（クリップ名）
+    char speaker[8];   // 名前から読み取った話者（なければ空）
+    const rawpack *pack; // アーカイブ内のクリップなら元のアーカイブ
+    int clip;
+    int frames;
+    int voiced;
+    double median_f0;
+    float *f0; // フレームごとのF0（無声は0）
+} pitch_result;
+
+// スレッドごとの作業領域（フレーム間で使い回す）
+typedef struct
+{
+    double re[FFT_SIZE];
+    double im[FFT_SIZE];
+} pitch_work;
+
+static double window[FRAME];    // ハン窓
+static double window_acf[FRAME]; // 窓の自己相関（正規化済み）
+static const char *out_dir;
+static rawpack packs[MAX_PACKS];
+static int num_packs;
+
+// x（FRAME点、窓かけ済み）の自己相関 r[0..FRAME) を work->re に求める
+static void autocorrelation(pitch_work *w, const double *x)
+{
+    for (int i = 0; i < FRAME; i++)
+    {
+        w->re[i] = x[i];
+        w->re[FRAME + i] = 0.0;
+    }
+    memset(w->im, 0, sizeof(w->im));
+    fft2048(w->re, w->im);
+    for (int k = 0; k < FFT_SIZE; k++)
+    {
+        w->re[k] = w->re[k] * w->re[k] + w->im[k] * w->im[k];
+        w->im[k] = 0.0;
+    }
+    fft2048_inverse(w->re, w->im);
+}
+
+static void init_window(void)
+{
+    static pitch_work w;
+    for (int i = 0; i < FRAME; i++)
+        window[i] = 0.5 - 0.5 * cos(2.0 * M_PI * (i + 0.5) / FRAME);
+    autocorrelation(&w, window);
+    for (int t = 0; t < FRAME; t++)
+        window_acf[t] = w.re[t] / w.re[0];
+}
+
+/**
+ * @brief 1フレームのF0を推定する
+ * @return F0（Hz）。無声・無音なら0
+ */
+static double estimate_frame(pitch_work *w, const int16_t *pcm)
+{
+    double x[FRAME];
+    double mean = 0.0, energy = 0.0;
+    for (int i = 0; i < FRAME; i++)
+        mean += pcm[i];
+    mean /= FRAME;
+    for (int i = 0; i < FRAME; i++)
+    {
+        double v = (pcm[i] - mean) / 32768.0;
+        energy += v * v;
+        x[i] = v * window[i];
+    }
+    if (10.0 * log10(energy / FRAME + 1e-20) < SILENCE_DB)
+        return 0.0;
+
+    autocorrelation(w, x);
+    double *r = w->re;
+    double r0 = r[0];
+    int lag_min = (int)(SAMPLING_RATE / F0_MAX);
+    int lag_max = (int)(SAMPLING_RATE / F0_MIN);
+    for (int t = lag_min - 1; t <= lag_max + 1; t++)
+        r[t] = r[t] / r0 / window_acf[t];
+
+    // 最大ピークの9割以上ある極大のうち、最も短い周期を選ぶ（倍周期の誤りを防ぐ）
+    double best = 0.0;
+    for (int t = lag_min; t <= lag_max; t++)
+    {
+        if (r[t] > best)
+            best = r[t];
+    }
+    if (best < VOICING)
+        return 0.0;
+    int lag = 0;
+    for (int t = lag_min; t <= lag_max; t++)
+    {
+        if (r[t] >= 0.9 * best && r[t] >= r[t - 1] && r[t] >= r[t + 1])
+        {
+            lag = t;
+            break;
+        }
+    }
+    if (lag == 0)
+        return 0.0;
+
+    // 放物線補間でピーク位置を細かく求める
+    double a = r[lag - 1], b = r[lag], c = r[lag + 1];
+    double denom = a - 2.0 * b + c;
+    double shift = (denom != 0.0) ? 0.5 * (a - c) / denom : 0.0;
+    return SAMPLING_RATE / (lag + shift);
+}
+
+static int compare_float(const void *a, const void *b)
+{
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+// .raw ファイルを丸ごと読み込む（呼び出し側で free する）
+static int16_t *read_pcm_file(const char *path, long *n)
+{
+    PROF_BEGIN(read_pcm);
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        fprintf(stderr, "ファイル %s が開けません\n", path);
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    *n = ftell(fp) / sizeof(int16_t);
+    fseek(fp, 0, SEEK_SET);
+    int16_t *pcm = (int16_t *)malloc(sizeof(int16_t) * (*n > FRAME ? *n : FRAME));
+    if (!pcm)
+    {
+        fprintf(stderr, "メモリ確保に失敗しました（%s）\n", path);
+        fclose(fp);
+        return NULL;
+    }
+    *n = fread(pcm, sizeof(int16_t), *n, fp);
+    fclose(fp);
+    PROF_END(read_pcm);
+    PROF_COUNT(read_pcm, samples, *n);
+    PROF_COUNT(read_pcm, bytes, *n * sizeof(int16_t));
+    PROF_COUNT(read_pcm, allocs, 1);
+    return pcm;
+}
+
+// 1クリップの全フレームを処理する
+static void process_file(pitch_result *res, pitch_work *w)
+{
+    long n;
+    int16_t *owned = NULL;
+    const int16_t *pcm;
+    if (res->pack)
+    {
+        // アーカイブ内のクリップは mmap 領域をそのまま読む
+        pcm = rawpack_samples(res->pack, res->clip);
+        n = res->pack->entries[res->clip].samples;
+        PROF_COUNT(read_clip, samples, n);
+    }
+    else
+    {
+        pcm = owned = read_pcm_file(res->path, &n);
+        if (!pcm)
+            return;
+    }
+
+    res->frames = (n >= FRAME) ? (int)((n - FRAME) / HOP + 1) : 0;
+    res->f0 = (float *)calloc(res->frames > 0 ? res->frames : 1, sizeof(float));
+    if (!res->f0)
+    {
+        free(owned);
+        return;
+    }
+
+    PROF_BEGIN(f0);
+    for (int f = 0; f < res->frames; f++)
+        res->f0[f] = (float)estimate_frame(w, pcm + (long)f * HOP);
+    PROF_END(f0);
+    PROF_COUNT(f0, frames, res->frames);
+    free(owned);
+
+    // 有声フレームの中央値
+    float *voiced = (float *)malloc(sizeof(float) * (res->frames > 0 ? res->frames : 1));
+    if (!voiced)
+        return;
+    for (int f = 0; f < res->frames; f++)
+    {
+        if (res->f0[f] > 0.0f)
+            voiced[res->voiced++] = res->f0[f];
+    }
+    if (res->voiced > 0)
+    {
+        qsort(voiced, res->voiced, sizeof(float), compare_float);
+        res->median_f0 = voiced[res->voiced / 2];
+    }
+    free(voiced);
+}
+
+// フレームごとのF0を「時刻[ms] F0[Hz]」形式で書き出す
+static void save_f0(const pitch_result *res)
+{
+    char outfile[MAX_PATH * 2];
+    snprintf(outfile, sizeof(outfile), "%s/%s.f0.txt", out_dir, res->name);
+
+    PROF_BEGIN(write_text);
+    FILE *fp = fopen(outfile, "w");
+    if (!fp)
+    {
+        perror("出力ファイルを開けません");
+        return;
+    }
+    for (int f = 0; f < res->frames; f++)
+        fprintf(fp, "%.1f\t%.2f\n", ((double)f * HOP + FRAME / 2) * 1000 / SAMPLING_RATE, res->f0[f]);
+    fclose(fp);
+    PROF_END(write_text);
+}
+
+// ---- バッチ処理 ----
+
+typedef struct
+{
+    pitch_result *results;
+    int count;
+} pitch_batch;
+
+static void batch_worker(void *arg, int id, int nthreads)
+{
+    pitch_batch *batch = (pitch_batch *)arg;
+    pitch_work *w = (pitch_work *)malloc(sizeof(pitch_work));
+    if (!w)
+        return;
+    for (int i = id; i < batch->count; i += nthreads)
+    {
+        process_file(&batch->results[i], w);
+        if (out_dir)
+            save_f0(&batch->results[i]);
+    }
+    free(w);
+}
+
+// 話者がわかり、F0が求まったクリップなら話者名を返す。それ以外は NULL
+static const char *speaker_of(const pitch_result *res)
+{
+    if (res->speaker[0] == '\0' || res->median_f0 <= 0.0)
+        return NULL;
+    return res->speaker;
+}
+
+// 一覧に .raw ファイルを1つ加える
+static int add_file(const char *path, pitch_result *results, int count)
+{
+    if (count >= MAX_FILES)
+        return count;
+    rawpack_entry e;
+    rawpack_parse_name(path, &e);
+    snprintf(results[count].path, MAX_PATH, "%s", path);
+    memcpy(results[count].name, e.name, sizeof(e.name));
+    memcpy(results[count].speaker, e.speaker, sizeof(e.speaker));
+    return count + 1;
+}
+
+// 一覧にアーカイブ内のクリップをすべて加える
+static int add_pack(const char *path, pitch_result *results, int count)
+{
+    if (num_packs >= MAX_PACKS || rawpack_open(&packs[num_packs], path) != 0)
+        return count;
+    const rawpack *pack = &packs[num_packs++];
+    for (uint32_t i = 0; i < pack->count && count < MAX_FILES; i++, count++)
+    {
+        const rawpack_entry *e = &pack->entries[i];
+        snprintf(results[count].path, MAX_PATH, "%s:%s", path, e->name);
+        memcpy(results[count].name, e->name, sizeof(e->name));
+        memcpy(results[count].speaker, e->speaker, sizeof(e->speaker));
+        results[count].pack = pack;
+        results[count].clip = (int)i;
+    }
+    return count;
+}
+
+static int compare_path(const void *a, const void *b)
+{
+    return strcmp(((const pitch_result *)a)->path, ((const pitch_result *)b)->path);
+}
+
+// 引数（ファイル・ディレクトリ・アーカイブ）から処理するクリップの一覧を作る
+static int collect_files(const char *arg, pitch_result *results, int count)
+{
+    struct stat st;
+    if (stat(arg, &st) != 0)
+    {
+        fprintf(stderr, "ファイル %s が見つかりません。\n", arg);
+        return count;
+    }
+    if (!S_ISDIR(st.st_mode))
+    {
+        size_t len = strlen(arg);
+        if (len > 5 && strcmp(arg + len - 5, ".pack") == 0)
+            return add_pack(arg, results, count);
+        return add_file(arg, results, count);
+    }
+
+    DIR *dir = opendir(arg);
+    if (!dir)
+    {
+        perror("opendir");
+        return count;
+    }
+    int first = count;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL && count < MAX_FILES)
+    {
+        size_t len = strlen(ent->d_name);
+        if (len > 4 && strcmp(ent->d_name + len - 4, ".raw") == 0)
+        {
+            char path[MAX_PATH];
+            snprintf(path, sizeof(path), "%s/%s", arg, ent->d_name);
+            count = add_file(path, results, count);
+        }
+    }
+    closedir(dir);
+    qsort(results + first, count - first, sizeof(pitch_result), compare_path);
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    prof_init(&argc, argv);
+
+    int nthreads = 0;
+    int opt, bad_option = 0;
+    while ((opt = getopt(argc, argv, "o:j:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'o':
+            out_dir = optarg;
+            break;
+        case 'j':
+            nthreads = atoi(optarg);
+            break;
+        default:
+            bad_option = 1;
+            break;
+        }
+    }
+    if (bad_option || optind >= argc)
+    {
+        fprintf(stderr, "使い方: %s [-o 出力ディレクトリ] [-j スレッド数] ファイル・ディレクトリ・アーカイブ ...\n", argv[0]);
+        return 1;
+    }
+
+    pitch_result *results = (pitch_result *)calloc(MAX_FILES, sizeof(pitch_result));
+    if (!results)
+    {
+        fprintf(stderr, "メモリ確保に失敗しました\n");
+        return 1;
+    }
+    int count = 0;
+    for (int i = optind; i < argc; i++)
+        count = collect_files(argv[i], results, count);
+    if (count == 0)
+    {
+        fprintf(stderr, ".raw ファイルがありません\n");
+        return 1;
+    }
+
+    init_window();
+
+    thread_pool *pool = thread_pool_create(nthreads);
+    if (!pool)
+    {
+        fprintf(stderr, "スレッドの作成に失敗しました\n");
+        return 1;
+    }
+    pitch_batch batch = {results, count};
+    thread_pool_run(pool, batch_worker, &batch);
+    thread_pool_destroy(pool);
+
+    // ファイルごとの結果
+    printf("ファイル\tフレーム数\t有声\tF0中央値[Hz]\n");
+    for (int i = 0; i < count; i++)
+    {
+        printf("%s\t%d\t%d\t%.1f\n", results[i].path, results[i].frames, results[i].voiced, results[i].median_f0);
+    }
+
+    // 話者ごとの平均（名前から話者がわかるクリップだけ）
+    printf("\n話者\tファイル数\t平均F0[Hz]\n");
+    for (int i = 0; i < count; i++)
+    {
+        const char *spk = speaker_of(&results[i]);
+        if (!spk)
+            continue;
+
+        // 同じ話者が前に出ていれば集計済み
+        int seen = 0;
+        for (int j = 0; j < i && !seen; j++)
+        {
+            const char *other = speaker_of(&results[j]);
+            seen = other && strcmp(other, spk) == 0;
+        }
+        if (seen)
+            continue;
+
+        double sum = 0.0;
+        int files = 0;
+        for (int j = i; j < count; j++)
+        {
+            const char *other = speaker_of(&results[j]);
+            if (other && strcmp(other, spk) == 0)
+            {
+                sum += results[j].median_f0;
+                files++;
+            }
+        }
+        printf("%s\t%d\t%.1f\n", spk, files, sum / files);
+    }
+
+    for (int i = 0; i < count; i++)
+        free(results[i].f0);
+    free(results);
+    for (int i = 0; i < num_packs; i++)
+        rawpack_close(&packs[i]);
+    return 0;
+}
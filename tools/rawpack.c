@@ -0,0 +1,215 @@
+// .raw クリップをまとめて1つのアーカイブ（lib/rawpack.h の形式）を作る・中身を表示する
+// 名前（拡張子なし）が31文字を超えるファイルと、既に入れた名前と重なるファイルは
+// 警告を出して飛ばす（rawpack_find_name で一意に引けるようにするため）
+//
+// コンパイル: gcc -O2 rawpack.c -o rawpack
+// 使い方: ./rawpack 出力.pack ファイルまたはディレクトリ ...
+//         ./rawpack -l アーカイブ.pack      （索引の表示）
+//   例: ./rawpack ../data/vowels.pack ../data ../data2
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "../lib/rawpack.h"
+
+#define SAMPLING_RATE 16000
+#define MAX_FILES 65536
+#define MAX_PATH 512
+
+static char (*paths)[MAX_PATH];
+
+static int compare_path(const void *a, const void *b)
+{
+    return strcmp((const char *)a, (const char *)b);
+}
+
+// 引数（ファイルまたはディレクトリ）から .raw ファイルの一覧を作る
+static int collect_files(const char *arg, int count)
+{
+    struct stat st;
+    if (stat(arg, &st) != 0)
+    {
+        fprintf(stderr, "ファイル %s が見つかりません。\n", arg);
+        return count;
+    }
+    if (!S_ISDIR(st.st_mode))
+    {
+        if (count < MAX_FILES)
+            snprintf(paths[count++], MAX_PATH, "%s", arg);
+        return count;
+    }
+
+    DIR *dir = opendir(arg);
+    if (!dir)
+    {
+        perror("opendir");
+        return count;
+    }
+    int first = count;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL && count < MAX_FILES)
+    {
+        size_t len = strlen(ent->d_name);
+        if (len > 4 && strcmp(ent->d_name + len - 4, ".raw") == 0)
+            snprintf(paths[count++], MAX_PATH, "%s/%s", arg, ent->d_name);
+    }
+    closedir(dir);
+    qsort(paths + first, count - first, MAX_PATH, compare_path);
+    return count;
+}
+
+// 0で埋めて pos を align の倍数まで進める
+static void pad_to(FILE *fp, uint64_t *pos, uint64_t align)
+{
+    static const char zeros[RAWPACK_DATA_ALIGN];
+    uint64_t pad = (align - *pos % align) % align;
+    fwrite(zeros, 1, pad, fp);
+    *pos += pad;
+}
+
+static int list_archive(const char *path)
+{
+    rawpack pack;
+    if (rawpack_open(&pack, path) != 0)
+        return 1;
+    printf("番号\t名前\t話者\t母音\t番号\t位置\tサンプル数\n");
+    for (uint32_t i = 0; i < pack.count; i++)
+    {
+        const rawpack_entry *e = &pack.entries[i];
+        printf("%u\t%s\t%s\t%s\t%d\t%llu\t%u\n", i, e->name, e->speaker, e->vowel, e->take,
+               (unsigned long long)e->offset, e->samples);
+    }
+    rawpack_close(&pack);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc == 3 && strcmp(argv[1], "-l") == 0)
+        return list_archive(argv[2]);
+    if (argc < 3)
+    {
+        fprintf(stderr, "使い方: %s 出力.pack ファイルまたはディレクトリ ...\n", argv[0]);
+        fprintf(stderr, "        %s -l アーカイブ.pack\n", argv[0]);
+        return 1;
+    }
+
+    paths = calloc(MAX_FILES, MAX_PATH);
+    if (!paths)
+    {
+        fprintf(stderr, "メモリ確保に失敗しました\n");
+        return 1;
+    }
+    int count = 0;
+    for (int i = 2; i < argc; i++)
+        count = collect_files(argv[i], count);
+    if (count == 0)
+    {
+        fprintf(stderr, ".raw ファイルがありません\n");
+        return 1;
+    }
+
+    rawpack_entry *entries = (rawpack_entry *)calloc(count, sizeof(rawpack_entry));
+    if (!entries)
+    {
+        fprintf(stderr, "メモリ確保に失敗しました\n");
+        return 1;
+    }
+
+    // 索引に入れられないファイルを除く
+    int kept = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (rawpack_parse_name(paths[i], &entries[kept]) != 0)
+        {
+            fprintf(stderr, "警告: %s は名前が長すぎるので飛ばします（%d文字まで）\n",
+                    paths[i], (int)sizeof(entries[kept].name) - 1);
+            continue;
+        }
+        int dup = -1;
+        for (int j = 0; j < kept && dup < 0; j++)
+        {
+            if (strcmp(entries[j].name, entries[kept].name) == 0)
+                dup = j;
+        }
+        if (dup >= 0)
+        {
+            fprintf(stderr, "警告: %s は %s と名前が同じなので飛ばします\n", paths[i], paths[dup]);
+            continue;
+        }
+        if (kept != i)
+            memcpy(paths[kept], paths[i], MAX_PATH);
+        kept++;
+    }
+    count = kept;
+    if (count == 0)
+    {
+        fprintf(stderr, "アーカイブに入れられる .raw ファイルがありません\n");
+        return 1;
+    }
+
+    FILE *out = fopen(argv[1], "wb");
+    if (!out)
+    {
+        perror("出力ファイルを開けません");
+        return 1;
+    }
+
+    rawpack_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, RAWPACK_MAGIC, 8);
+    header.count = count;
+    header.sampling_rate = SAMPLING_RATE;
+    header.index_offset = sizeof(rawpack_header);
+
+    // ヘッダと索引の場所を空けておき、データ部を先に書く
+    uint64_t pos = header.index_offset + (uint64_t)count * sizeof(rawpack_entry);
+    fseek(out, pos, SEEK_SET);
+    pad_to(out, &pos, RAWPACK_DATA_ALIGN);
+    header.data_offset = pos;
+
+    static char buf[1 << 16];
+    for (int i = 0; i < count; i++)
+    {
+        FILE *in = fopen(paths[i], "rb");
+        if (!in)
+        {
+            fprintf(stderr, "ファイル %s が開けません\n", paths[i]);
+            return 1;
+        }
+        pad_to(out, &pos, RAWPACK_CLIP_ALIGN);
+        entries[i].offset = pos;
+
+        uint64_t bytes = 0;
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), in)) > 0)
+        {
+            fwrite(buf, 1, n, out);
+            bytes += n;
+        }
+        fclose(in);
+        if (bytes % 2 != 0) // 半端な1バイトは捨てる（16bit単位にそろえる）
+        {
+            fseek(out, -1, SEEK_CUR);
+            bytes--;
+        }
+        entries[i].samples = (uint32_t)(bytes / sizeof(int16_t));
+        pos += bytes;
+    }
+
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(entries, sizeof(rawpack_entry), count, out);
+    if (fclose(out) != 0)
+    {
+        perror("書き込みに失敗しました");
+        return 1;
+    }
+
+    printf("%d 個のクリップを %s にまとめました（%llu バイト）\n", count, argv[1], (unsigned long long)pos);
+    free(entries);
+    free(paths);
+    return 0;
+}
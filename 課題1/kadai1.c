@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/stat.h>
+#include "../lib/prof.h"
 
 #define SAMPLING_RATE 16000 // 16 kHz
 #define AMPLIFY3 3
@@ -48,9 +50,11 @@ short saturate(int value)
 
 int main(int argc, char *argv[])
 {
+    prof_init(&argc, argv);
     if (argc != 5)
     {
         printf("使い方: %s 入力.raw 出力.txt 出力3倍.raw 出力30倍.raw\n", argv[0]);
+        printf("        （出力.txt に - を指定するとテキスト出力をすべて省く）\n");
         return 1;
     }
 
@@ -58,6 +62,7 @@ int main(int argc, char *argv[])
     const char *text_file = argv[2];
     const char *loud3_file = argv[3];
     const char *loud30_file = argv[4];
+    int write_text = strcmp(text_file, "-") != 0;
     char text3_file[256], text30_file[256];
     snprintf(text3_file, sizeof(text3_file), "%s.txt", loud3_file);
     snprintf(text30_file, sizeof(text30_file), "%s.txt", loud30_file);
@@ -76,6 +81,8 @@ int main(int argc, char *argv[])
     short *wave = (short *)calloc(num_samples, sizeof(short));
     short *wave3 = (short *)calloc(num_samples, sizeof(short));
     short *wave30 = (short *)calloc(num_samples, sizeof(short));
+    PROF_COUNT(alloc, allocs, 3);
+    PROF_COUNT(alloc, bytes, 3 * num_samples * sizeof(short));
 
     if (!wave || !wave3 || !wave30)
     {
@@ -84,6 +91,7 @@ int main(int argc, char *argv[])
     }
 
     // データ読み込み
+    PROF_BEGIN(read_pcm);
     FILE *fp = fopen(input_file, "rb");
     if (!fp)
     {
@@ -93,20 +101,36 @@ int main(int argc, char *argv[])
 
     fread(wave, sizeof(short), num_samples, fp);
     fclose(fp);
+    PROF_END(read_pcm);
+    PROF_COUNT(read_pcm, samples, num_samples);
+    PROF_COUNT(read_pcm, bytes, file_size);
 
     // 3倍 & 30倍振幅波形作成
+    PROF_BEGIN(amplify);
     for (int i = 0; i < num_samples; i++)
     {
         wave3[i] = saturate(wave[i] * AMPLIFY3);
         wave30[i] = saturate(wave[i] * AMPLIFY30);
     }
+    PROF_END(amplify);
+    PROF_COUNT(amplify, samples, num_samples);
 
     // 出力
-    save_text_data(wave, num_samples, text_file);
-    save_text_data(wave3, num_samples, text3_file);
-    save_text_data(wave30, num_samples, text30_file);
+    if (write_text)
+    {
+        PROF_BEGIN(write_text);
+        save_text_data(wave, num_samples, text_file);
+        save_text_data(wave3, num_samples, text3_file);
+        save_text_data(wave30, num_samples, text30_file);
+        PROF_END(write_text);
+        PROF_COUNT(write_text, samples, 3 * num_samples);
+    }
+
+    PROF_BEGIN(write_raw);
     save_raw_data(wave3, num_samples, loud3_file);
     save_raw_data(wave30, num_samples, loud30_file);
+    PROF_END(write_raw);
+    PROF_COUNT(write_raw, bytes, 2 * num_samples * sizeof(short));
 
     free(wave);
     free(wave3);
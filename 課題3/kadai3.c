@@ -2,6 +2,7 @@
 #include <stdlib.h>          // exit関数などのための標準ライブラリ
 #include <math.h>            // sin, cos, M_PIなどの数学関数を使うため
 #include "kadai3_DFT_IDFT.h" // 自作のDFTとIDFT関数が書かれたヘッダファイル
+#include "../lib/prof.h"      // 処理段ごとの計測
 
 #define PI 3.141592653589793
 #define SAMPLING_RATE 16000 // サンプリング周波数（Hz）
@@ -37,22 +38,29 @@ void save_to_raw(const char *filename, double *data, int size)
     fclose(fp);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
+    prof_init(&argc, argv);
+
     // 正弦波と余弦波の実部・虚部配列の宣言と初期化
     double sine[N], sine_i[N] = {0};     // sin波の虚部は全て0で初期化
     double cosine[N], cosine_i[N] = {0}; // cos波の虚部も全て0で初期化
 
     // 正弦波と余弦波の生成（DFT長Nに基づいて1周期を構成）
+    PROF_BEGIN(generate);
     for (int n = 0; n < N; n++)
     {
         sine[n] = sin(2 * PI * FREQ_SINE * n / N);  // 正弦波（0〜2πの1周期）
         cosine[n] = cos(2 * PI * FREQ_COS * n / N); // 余弦波（0〜2πの1周期）
     }
+    PROF_END(generate);
+    PROF_COUNT(generate, samples, 2 * N);
 
     // 元の波形（時間領域）をファイルに保存
+    PROF_BEGIN(write_text);
     save_to_file("sinreal.txt", sine, N);
     save_to_file("cosreal.txt", cosine, N);
+    PROF_END(write_text);
 
     // DFTを行うためにコピー（元データを変更しないように）
     double sine_dft_r[N], sine_dft_i[N];
@@ -66,14 +74,19 @@ int main()
     }
 
     // DFT（離散フーリエ変換）を実行
+    PROF_BEGIN(DFT);
     DFT(N, sine_dft_r, sine_dft_i);     // sin波の周波数スペクトル
     DFT(N, cosine_dft_r, cosine_dft_i); // cos波の周波数スペクトル
+    PROF_END(DFT);
+    PROF_COUNT(DFT, frames, 2);
 
     // DFTの結果（実部・虚部）をファイルに保存
+    PROF_BEGIN(write_text);
     save_to_file("sin_dft_real.txt", sine_dft_r, N);
     save_to_file("sin_dft_imag.txt", sine_dft_i, N);
     save_to_file("cos_dft_real.txt", cosine_dft_r, N);
     save_to_file("cos_dft_imag.txt", cosine_dft_i, N);
+    PROF_END(write_text);
 
     // IDFT用にDFT結果をコピー（DFTの出力をIDFTの入力とする）
     double sine_idft_r[N], sine_idft_i[N];
@@ -87,17 +100,25 @@ int main()
     }
 
     // IDFT（逆離散フーリエ変換）を実行
+    PROF_BEGIN(IDFT);
     IDFT(N, sine_idft_r, sine_idft_i);
     IDFT(N, cosine_idft_r, cosine_idft_i);
+    PROF_END(IDFT);
+    PROF_COUNT(IDFT, frames, 2);
 
     // IDFTの結果（時間領域に戻った波形）をファイルに保存
+    PROF_BEGIN(write_text);
     save_to_file("sin_idft_real.txt", sine_idft_r, N);
     save_to_file("sin_idft_imag.txt", sine_idft_i, N);
     save_to_file("cos_idft_real.txt", cosine_idft_r, N);
     save_to_file("cos_idft_imag.txt", cosine_idft_i, N);
+    PROF_END(write_text);
  // RAW形式でも保存（1サンプル = double）
+    PROF_BEGIN(write_raw);
     save_to_raw("sine.raw", sine, N);
     save_to_raw("cosine.raw", cosine, N);
+    PROF_END(write_raw);
+    PROF_COUNT(write_raw, bytes, 2 * N * sizeof(double));
     return 0; // 正常終了
    
 }
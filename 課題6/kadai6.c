@@ -1,15 +1,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include "shift.h"
 #include "conv.h"
-#define TAP 101 // フィルタ長
+#include "../lib/prof.h" // 処理段ごとの計測
+#include "../lib/iir.h"  // -iir 指定時のIIRフィルタ
+#define MAX_TAP 1024 // フィルタ長の上限（実際の長さは係数ファイルの行数）
+#define BLOCK 1024 // 一度に読み書きするサンプル数
 #define INPUT_FILE "../data/mix.raw"
 #define OUTPUT_FILE "output.raw"
 #define COEFF_FILE "../課題５/fir_coeff_N100.txt"
 #define TXT_ORIG_FILE "mix.txt"
 #define TXT_OUT_FILE "filtered.txt"
 #define FS 16000 // サンプリング周波数（例: 16kHz）
+#define IIR_CUTOFF 0.4 // IIRの遮断周波数（課題5の OMEGA_C と同じ正規化周波数）
+#define IIR_RP 1.0     // IIRの通過域リップル [dB]
+#define IIR_RS 60.0    // IIRの阻止域減衰量 [dB]
 
 
 // フィルタ係数読み込み
@@ -22,7 +29,7 @@ int load_coefficients(const char *filename, double *h, int max_tap)
         exit(1);
     }
     int n = 0;
-    while (fscanf(fp, "%*d %lf", &h[n]) == 1 && n < max_tap)
+    while (n < max_tap && fscanf(fp, "%*d %lf", &h[n]) == 1)
     {
         n++;
     }
@@ -30,61 +37,156 @@ int load_coefficients(const char *filename, double *h, int max_tap)
     return n;
 }
 
-int main()
+// 出力を [-1, 1] に収める
+static double clip(double y)
 {
-    FILE *fp_in = fopen(INPUT_FILE, "rb");
+    if (y > 1.0)
+        y = 1.0;
+    if (y < -1.0)
+        y = -1.0;
+    return y;
+}
+
+int main(int argc, char *argv[])
+{
+    prof_init(&argc, argv);
+    const char *prog = argv[0];
+
+    // -iir 種類:次数 （例: ellip:8）: 係数ファイルのFIRの代わりにIIR（biquad縦続）を使う
+    iir_cascade iir;
+    int use_iir = 0;
+    if (argc >= 3 && strcmp(argv[1], "-iir") == 0)
+    {
+        char name[16];
+        int order;
+        int type = -1;
+        if (sscanf(argv[2], "%15[^:]:%d", name, &order) == 2)
+            type = iir_type_from_name(name);
+        if (type < 0 || iir_design(&iir, type, IIR_LOWPASS, order, IIR_CUTOFF, IIR_RP, IIR_RS) != 0)
+        {
+            fprintf(stderr, "IIRの指定が不正です: %s（butter|cheby1|ellip:1〜%d）\n", argv[2], IIR_MAX_ORDER);
+            return 1;
+        }
+        use_iir = 1;
+        argc -= 2;
+        argv += 2;
+    }
+
+    // 引数省略時は従来どおりの固定パス: [入力.raw 出力.raw [係数ファイル]]
+    // 入出力を指定したとき（スクリプトから呼ぶとき）は mix.txt / filtered.txt を書かない
+    if (argc != 1 && argc != 3 && (argc != 4 || use_iir))
+    {
+        fprintf(stderr, "使い方: %s [入力.raw 出力.raw [係数ファイル]]\n", prog);
+        fprintf(stderr, "        %s -iir 種類:次数 [入力.raw 出力.raw]\n", prog);
+        return 1;
+    }
+    const char *input_file = (argc >= 3) ? argv[1] : INPUT_FILE;
+    const char *output_file = (argc >= 3) ? argv[2] : OUTPUT_FILE;
+    const char *coeff_file = (argc == 4) ? argv[3] : COEFF_FILE;
+    int write_text = (argc == 1);
+
+    FILE *fp_in = fopen(input_file, "rb");
     if (!fp_in)
     {
         perror("入力ファイルを開けません");
         return 1;
     }
 
-    FILE *fp_out = fopen(OUTPUT_FILE, "wb");
-    FILE *fp_txt_orig = fopen(TXT_ORIG_FILE, "w");
-    FILE *fp_txt_filt = fopen(TXT_OUT_FILE, "w");
+    FILE *fp_out = fopen(output_file, "wb");
+    FILE *fp_txt_orig = write_text ? fopen(TXT_ORIG_FILE, "w") : NULL;
+    FILE *fp_txt_filt = write_text ? fopen(TXT_OUT_FILE, "w") : NULL;
 
-    if (!fp_out || !fp_txt_orig || !fp_txt_filt)
+    if (!fp_out || (write_text && (!fp_txt_orig || !fp_txt_filt)))
     {
         perror("出力ファイルを開けません");
         return 1;
     }
 
-    double h[TAP];
-    double x[TAP] = {0};
-    load_coefficients(COEFF_FILE, h, TAP);
+    double h[MAX_TAP];
+    double x[MAX_TAP] = {0};
+    int tap = use_iir ? 0 : load_coefficients(coeff_file, h, MAX_TAP);
 
-    int16_t sample_in, sample_out;
+    int16_t sample_in[BLOCK], sample_out[BLOCK];
+    double xn[BLOCK], yn[BLOCK];
     int n = 0;
+    size_t count;
 
-    while (fread(&sample_in, sizeof(int16_t), 1, fp_in) == 1)
+    // BLOCKサンプルずつ読み込み → フィルタ → 書き出し
+    for (;;)
     {
-        double xn = sample_in / 32768.0;
-
-        // 時間（秒）をX軸に、正規化した元データを出力
-        fprintf(fp_txt_orig, "%.6f\t%.6f\n", (double)n * 1000 / FS, xn);
-
-        shift(xn, x, TAP);
-        double yn = conv(h, x, TAP);
-
-        if (yn > 1.0)
-            yn = 1.0;
-        if (yn < -1.0)
-            yn = -1.0;
-
-        sample_out = (int16_t)(yn * 32767.0);
-        fwrite(&sample_out, sizeof(int16_t), 1, fp_out);
-
-        // 正規化後の出力データを書き出し
-        fprintf(fp_txt_filt, "%.6f\t%.6f\n", (double)n *1000/ FS, yn);
-
-        n++;
+        PROF_BEGIN(read_pcm);
+        count = fread(sample_in, sizeof(int16_t), BLOCK, fp_in);
+        PROF_END(read_pcm);
+        if (count == 0)
+            break;
+        PROF_COUNT(read_pcm, samples, count);
+        PROF_COUNT(read_pcm, bytes, count * sizeof(int16_t));
+
+        if (use_iir)
+        {
+            // ブロックごとにまとめてIIRに通す（状態は iir に残る）
+            PROF_BEGIN(iir);
+            for (size_t i = 0; i < count; i++)
+                xn[i] = sample_in[i] / 32768.0;
+            iir_process(&iir, xn, yn, (int)count);
+            for (size_t i = 0; i < count; i++)
+            {
+                yn[i] = clip(yn[i]);
+                sample_out[i] = (int16_t)(yn[i] * 32767.0);
+            }
+            PROF_END(iir);
+            PROF_COUNT(iir, samples, count);
+            PROF_COUNT(iir, frames, 1);
+        }
+        else
+        {
+            PROF_BEGIN(conv);
+            for (size_t i = 0; i < count; i++)
+            {
+                xn[i] = sample_in[i] / 32768.0;
+
+                shift(xn[i], x, tap);
+                double y = clip(conv(h, x, tap));
+
+                yn[i] = y;
+                sample_out[i] = (int16_t)(y * 32767.0);
+            }
+            PROF_END(conv);
+            PROF_COUNT(conv, samples, count);
+            PROF_COUNT(conv, frames, 1);
+        }
+
+        PROF_BEGIN(write_raw);
+        fwrite(sample_out, sizeof(int16_t), count, fp_out);
+        PROF_END(write_raw);
+        PROF_COUNT(write_raw, bytes, count * sizeof(int16_t));
+
+        if (write_text)
+        {
+            PROF_BEGIN(write_text);
+            for (size_t i = 0; i < count; i++)
+            {
+                // 時間（秒）をX軸に、正規化した元データを出力
+                fprintf(fp_txt_orig, "%.6f\t%.6f\n", (double)(n + i) * 1000 / FS, xn[i]);
+
+                // 正規化後の出力データを書き出し
+                fprintf(fp_txt_filt, "%.6f\t%.6f\n", (double)(n + i) * 1000 / FS, yn[i]);
+            }
+            PROF_END(write_text);
+            PROF_COUNT(write_text, samples, 2 * count);
+        }
+
+        n += count;
     }
 
     fclose(fp_in);
     fclose(fp_out);
-    fclose(fp_txt_orig);
-    fclose(fp_txt_filt);
+    if (write_text)
+    {
+        fclose(fp_txt_orig);
+        fclose(fp_txt_filt);
+    }
 
-    printf("Filtering complete. Output written to '%s'\n", OUTPUT_FILE);
+    printf("Filtering complete. Output written to '%s'\n", output_file);
     return 0;
 }
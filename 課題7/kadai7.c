@@ -2,6 +2,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include "../lib/fft_fixed.h"  // 1024点固定長FFT
+#include "../lib/prof.h"       // 処理段ごとの計測
+#include "../lib/rawpack.h"    // クリップをまとめたアーカイブ
 
 #define SAMPLE_SIZE 1024      // 読み込むサンプル数
 #define NUM_VOWELS 5          // 母音の数
@@ -15,11 +18,9 @@ const char* template_files[NUM_VOWELS] = {
 // テンプレート用スペクトル配列
 double templates[NUM_VOWELS][SAMPLE_SIZE];
 
-// fft.o に含まれるFFT関数の宣言（実装は.oにある）
-void fft(int n, double* x_real, double* x_imag);
-
 // 音声データ（16bit PCM）の読み込み
 void read_raw(const char* filename, double* buffer) {
+    PROF_BEGIN(read_pcm);
     FILE* fp = fopen(filename, "rb");
     if (!fp) {
         fprintf(stderr, "ファイル %s が開けません\n", filename);
@@ -34,6 +35,25 @@ void read_raw(const char* filename, double* buffer) {
         buffer[i] = (double)temp;
     }
     fclose(fp);
+    PROF_END(read_pcm);
+    PROF_COUNT(read_pcm, samples, SAMPLE_SIZE);
+    PROF_COUNT(read_pcm, bytes, SAMPLE_SIZE * sizeof(short));
+}
+
+// アーカイブ内のクリップを読み込む（コピーのみ、システムコールなし）
+void read_clip(const rawpack* pack, int index, double* buffer) {
+    const rawpack_entry* e = &pack->entries[index];
+    if (e->samples < SAMPLE_SIZE) {
+        fprintf(stderr, "クリップ %s が短すぎます\n", e->name);
+        exit(1);
+    }
+    PROF_BEGIN(read_clip);
+    const int16_t* pcm = rawpack_samples(pack, index);
+    for (int i = 0; i < SAMPLE_SIZE; i++) {
+        buffer[i] = (double)pcm[i];
+    }
+    PROF_END(read_clip);
+    PROF_COUNT(read_clip, samples, SAMPLE_SIZE);
 }
 
 // 対数パワースペクトルの計算
@@ -44,7 +64,10 @@ void compute_log_power_spectrum(double* signal, double* log_power) {
         imag[i] = 0.0;
     }
 
-    fft(SAMPLE_SIZE, real, imag);
+    PROF_BEGIN(FFT);
+    fft1024(real, imag);  // SAMPLE_SIZE = 1024
+    PROF_END(FFT);
+    PROF_COUNT(FFT, frames, 1);
 
     for (int i = 0; i < SAMPLE_SIZE; i++) {
         double power = real[i]*real[i] + imag[i]*imag[i];
@@ -62,10 +85,66 @@ double euclidean_distance(double* a, double* b) {
     return sqrt(sum);
 }
 
+// 各テンプレートとの距離を比較し、最も近い母音の番号を返す
+int recognize(double* input_log_power, double* min_distance) {
+    PROF_BEGIN(distance);
+    int recognized_index = 0;
+    *min_distance = euclidean_distance(input_log_power, templates[0]);
+
+    for (int i = 1; i < NUM_VOWELS; i++) {
+        double dist = euclidean_distance(input_log_power, templates[i]);
+        if (dist < *min_distance) {
+            *min_distance = dist;
+            recognized_index = i;
+        }
+    }
+
+    PROF_END(distance);
+    return recognized_index;
+}
+
+// アーカイブ内の母音クリップ（テンプレート以外）をすべて認識し、正解率を出す
+void recognize_all(const rawpack* pack) {
+    int total = 0, correct = 0;
+    for (uint32_t c = 0; c < pack->count; c++) {
+        const rawpack_entry* e = &pack->entries[c];
+        int answer = -1;
+        for (int i = 0; i < NUM_VOWELS; i++) {
+            if (strcmp(e->vowel, vowel_labels[i]) == 0)
+                answer = i;
+        }
+        if (answer < 0 || (e->speaker[0] == '\0' && e->take == 0) || e->samples < SAMPLE_SIZE)
+            continue;
+
+        double signal[SAMPLE_SIZE];
+        double log_power[SAMPLE_SIZE];
+        double distance;
+        read_clip(pack, c, signal);
+        compute_log_power_spectrum(signal, log_power);
+        int result = recognize(log_power, &distance);
+
+        printf("%s\t正解 /%s/\t認識結果 /%s/ （ユークリッド距離: %.2f）\n",
+               e->name, vowel_labels[answer], vowel_labels[result], distance);
+        total++;
+        correct += (result == answer);
+    }
+    if (total > 0)
+        printf("正解率: %d / %d (%.1f%%)\n", correct, total, 100.0 * correct / total);
+}
+
 // メイン関数
 int main(int argc, char* argv[]) {
-    if (argc != 2) {
+    prof_init(&argc, argv);
+
+    // -p アーカイブ: テンプレートと入力をアーカイブから読む（入力省略時は全クリップ）
+    rawpack pack = {0};
+    int use_pack = (argc >= 3 && strcmp(argv[1], "-p") == 0);
+    if (use_pack ? (argc > 4) : (argc != 2)) {
         printf("使い方: %s 入力ファイル名\n", argv[0]);
+        printf("        %s -p アーカイブ.pack [クリップ名]\n", argv[0]);
+        return 1;
+    }
+    if (use_pack && rawpack_open(&pack, argv[2]) != 0) {
         return 1;
     }
 
@@ -73,28 +152,46 @@ int main(int argc, char* argv[]) {
     for (int i = 0; i < NUM_VOWELS; i++) {
         double signal[SAMPLE_SIZE];
         double log_power[SAMPLE_SIZE];
-        read_raw(template_files[i], signal);
+        if (use_pack) {
+            rawpack_entry t;
+            rawpack_parse_name(template_files[i], &t);
+            int index = rawpack_find_name(&pack, t.name);
+            if (index < 0) {
+                fprintf(stderr, "アーカイブにテンプレート %s がありません\n", t.name);
+                return 1;
+            }
+            read_clip(&pack, index, signal);
+        } else {
+            read_raw(template_files[i], signal);
+        }
         compute_log_power_spectrum(signal, log_power);
         memcpy(templates[i], log_power, sizeof(double) * SAMPLE_SIZE);
     }
 
+    if (use_pack && argc == 3) {
+        recognize_all(&pack);
+        rawpack_close(&pack);
+        return 0;
+    }
+
     // 入力音声の処理
     double input_signal[SAMPLE_SIZE];
     double input_log_power[SAMPLE_SIZE];
-    read_raw(argv[1], input_signal);
-    compute_log_power_spectrum(input_signal, input_log_power);
-
-    // 各テンプレートとの距離を比較
-    int recognized_index = 0;
-    double min_distance = euclidean_distance(input_log_power, templates[0]);
-
-    for (int i = 1; i < NUM_VOWELS; i++) {
-        double dist = euclidean_distance(input_log_power, templates[i]);
-        if (dist < min_distance) {
-            min_distance = dist;
-            recognized_index = i;
+    if (use_pack) {
+        int index = rawpack_find_name(&pack, argv[3]);
+        if (index < 0) {
+            fprintf(stderr, "アーカイブにクリップ %s がありません\n", argv[3]);
+            return 1;
         }
+        read_clip(&pack, index, input_signal);
+        rawpack_close(&pack);
+    } else {
+        read_raw(argv[1], input_signal);
     }
+    compute_log_power_spectrum(input_signal, input_log_power);
+
+    double min_distance;
+    int recognized_index = recognize(input_log_power, &min_distance);
 
     printf("認識結果: /%s/ （ユークリッド距離: %.2f）\n",
            vowel_labels[recognized_index], min_distance);
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include "../lib/prof.h"
 
 #define SAMPLING_RATE 16000 // 16 kHz
 #define CENTER_DURATION_MS 20
@@ -46,12 +47,14 @@ void extract_and_save_center_20ms(const char *infile, const char *outfile)
     }
 
     short *wave = (short *)malloc(sizeof(short) * window_samples);
+    PROF_COUNT(alloc, allocs, 1);
     if (!wave)
     {
         fprintf(stderr, "メモリ確保失敗（%s）\n", infile);
         return;
     }
 
+    PROF_BEGIN(read_pcm);
     FILE *fp = fopen(infile, "rb");
     if (!fp)
     {
@@ -71,6 +74,9 @@ void extract_and_save_center_20ms(const char *infile, const char *outfile)
 
     size_t read_count = fread(wave, sizeof(short), window_samples, fp);
     fclose(fp);
+    PROF_END(read_pcm);
+    PROF_COUNT(read_pcm, samples, read_count);
+    PROF_COUNT(read_pcm, bytes, read_count * sizeof(short));
 
     if (read_count != window_samples)
     {
@@ -79,6 +85,7 @@ void extract_and_save_center_20ms(const char *infile, const char *outfile)
         return;
     }
 
+    PROF_BEGIN(write_text);
     FILE *out = fopen(outfile, "w");
     if (!out)
     {
@@ -94,6 +101,8 @@ void extract_and_save_center_20ms(const char *infile, const char *outfile)
     }
 
     fclose(out);
+    PROF_END(write_text);
+    PROF_COUNT(write_text, samples, window_samples);
     free(wave);
 
     printf("%s → %s に保存しました（開始時刻 %.3f ms）\n",
@@ -102,6 +111,7 @@ void extract_and_save_center_20ms(const char *infile, const char *outfile)
 
 int main(int argc, char *argv[])
 {
+    prof_init(&argc, argv);
     if (argc != 6)
     {
         fprintf(stderr, "使い方: %s a00.raw i00.raw u00.raw e00.raw o00.raw\n", argv[0]);
@@ -1,28 +1,29 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 #include <sys/stat.h>
-#include "../課題3/kadai3_DFT_IDFT.h"  // 課題3のDFT関数
+#include "../lib/fft_fixed.h"  // 1024点固定長FFT
+#include "../lib/fft_large.h"  // 全体スペクトル用 six-step FFT
+#include "../lib/prof.h"       // 処理段ごとの計測
 
 #define DFT_SIZE 1024
 #define SAMPLING_RATE 16000
-
-// ハミング窓関数を生成
-void apply_hamming_window(double *x, int L) {
-    for (int n = 0; n < L; n++) {
-        double w = 0.54 - 0.46 * cos(2.0 * M_PI * n / (L - 1));
-        x[n] *= w;
-    }
-}
+#define FULL_MIN_SIZE (1 << 16) // -full のFFT長の下限
+#define FULL_MAX_SIZE (1 << 24) // -full のFFT長の上限
 
 int main(int argc, char *argv[]) {
-    if (argc != 3) {
-        fprintf(stderr, "使い方: %s 入力.raw 出力.txt\n", argv[0]);
+    prof_init(&argc, argv);
+
+    // -full: 先頭1024点ではなくファイル全体を1回のFFTで変換する
+    int full = (argc == 4 && strcmp(argv[1], "-full") == 0);
+    if (argc != 3 && !full) {
+        fprintf(stderr, "使い方: %s [-full] 入力.raw 出力.txt\n", argv[0]);
         return 1;
     }
 
-    const char *infile = argv[1];
-    const char *outfile = argv[2];
+    const char *infile = argv[argc - 2];
+    const char *outfile = argv[argc - 1];
 
     // 入力ファイルサイズ確認
     struct stat st;
@@ -33,11 +34,13 @@ int main(int argc, char *argv[]) {
 
     int L = st.st_size / sizeof(short);
     short *raw = (short *)calloc(L, sizeof(short));
+    PROF_COUNT(alloc, allocs, 1);
     if (!raw) {
         perror("メモリ確保失敗");
         return 1;
     }
 
+    PROF_BEGIN(read_pcm);
     FILE *fp = fopen(infile, "rb");
     if (!fp) {
         perror("ファイルオープン失敗");
@@ -46,22 +49,71 @@ int main(int argc, char *argv[]) {
     }
     fread(raw, sizeof(short), L, fp);
     fclose(fp);
+    PROF_END(read_pcm);
+    PROF_COUNT(read_pcm, samples, L);
+    PROF_COUNT(read_pcm, bytes, L * sizeof(short));
 
-    // 波形をdouble型に変換してゼロパディング
-    double xr[DFT_SIZE] = {0};
-    double xi[DFT_SIZE] = {0};
+    // FFT長: 通常は DFT_SIZE、-full ではファイル長以上の2のべき乗
+    int N = DFT_SIZE;
+    if (full) {
+        N = FULL_MIN_SIZE;
+        while (N < L && N < FULL_MAX_SIZE)
+            N <<= 1;
+        if (L > N) {
+            fprintf(stderr, "ファイルが長すぎます（%dサンプルまで）\n", FULL_MAX_SIZE);
+            free(raw);
+            return 1;
+        }
+    }
 
-    for (int i = 0; i < L && i < DFT_SIZE; i++) {
+    // 波形をdouble型に変換してゼロパディング（大きいのでヒープに確保）
+    double *xr = fft_large_alloc(N);
+    double *xi = fft_large_alloc(N);
+    PROF_COUNT(alloc, allocs, 2);
+    if (!xr || !xi) {
+        perror("メモリ確保失敗");
+        free(raw);
+        return 1;
+    }
+    memset(xr, 0, sizeof(double) * N);
+    memset(xi, 0, sizeof(double) * N);
+
+    for (int i = 0; i < L && i < N; i++) {
         xr[i] = (double)raw[i];
     }
 
-    // ハミング窓適用
-    apply_hamming_window(xr, (L < DFT_SIZE ? L : DFT_SIZE));
+    // ハミング窓適用（DFT_SIZE点そろっていればテーブル版）
+    PROF_BEGIN(window);
+    if (!full && L >= DFT_SIZE)
+        fft1024_apply_window(xr);
+    else
+        hamming_window(xr, (L < N ? L : N));
+    PROF_END(window);
 
-    // DFT実行
-    DFT(DFT_SIZE, xr, xi);
+    if (full) {
+        // FFT実行（six-step、全コアで分担）
+        fft_large_plan *plan = fft_large_plan_create(N, 0);
+        if (!plan) {
+            fprintf(stderr, "FFTの準備に失敗しました\n");
+            free(raw);
+            free(xr);
+            free(xi);
+            return 1;
+        }
+        PROF_BEGIN(FFT);
+        fft_large(plan, xr, xi, 0);
+        PROF_END(FFT);
+        fft_large_plan_destroy(plan);
+    } else {
+        // FFT実行（DFT_SIZE = 1024 の固定長版）
+        PROF_BEGIN(FFT);
+        fft1024(xr, xi);
+        PROF_END(FFT);
+    }
+    PROF_COUNT(FFT, frames, 1);
 
     // 結果出力 (.txt)
+    PROF_BEGIN(write_text);
     FILE *out = fopen(outfile, "w");
     if (!out) {
         perror("出力ファイル作成失敗");
@@ -69,16 +121,22 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    for (int k = 0; k < DFT_SIZE; k++) {
+    // -full は周波数分解能が細かいので、ナイキスト周波数までを小数3桁で出力
+    int K = full ? N / 2 + 1 : N;
+    for (int k = 0; k < K; k++) {
         double power = xr[k] * xr[k] + xi[k] * xi[k];
         double log_power = log10(power + 1e-6); // εでゼロ除算回避
-        double freq = (double)k * SAMPLING_RATE / DFT_SIZE;
-        fprintf(out, "%.1f\t%.6f\n", freq, log_power);
+        double freq = (double)k * SAMPLING_RATE / N;
+        fprintf(out, full ? "%.3f\t%.6f\n" : "%.1f\t%.6f\n", freq, log_power);
     }
 
     fclose(out);
+    PROF_END(write_text);
+    PROF_COUNT(write_text, samples, K);
     free(raw);
+    free(xr);
+    free(xi);
 
-    printf("出力完了: %s → %s（%d点）\n", infile, outfile, DFT_SIZE);
+    printf("出力完了: %s → %s（%d点）\n", infile, outfile, N);
     return 0;
 }
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "../課題3/kadai3_DFT_IDFT.h"  // 課題3のDFT関数
+#include "../lib/prof.h"               // 処理段ごとの計測
 
 #define PI 3.14159265358979323846
 #define MAX_N 1024  // 十分なゼロパディングを行う
@@ -59,7 +60,8 @@ void output_amplitude_spectrum(double *xr, double *xi, int N, const char *filena
     printf("Amplitude spectrum saved to %s\n", filename);
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    prof_init(&argc, argv);
     int Ns[] = {100, 500, 1000};
     char coeff_filename[64];
     char amp_filename[64];
@@ -72,15 +74,23 @@ int main() {
 
         // FIR係数とファイル名設定
         snprintf(coeff_filename, sizeof(coeff_filename), "fir_coeff_N%d.txt", N);
+        PROF_BEGIN(design);
         generate_fir_coeff(N, h, coeff_filename);
+        PROF_END(design);
+        PROF_COUNT(design, samples, N + 1);
 
         // DFT実行
         // xrは実部としてh、xiは虚部（0）で入力
+        PROF_BEGIN(DFT);
         DFT(MAX_N, h, xi);
+        PROF_END(DFT);
+        PROF_COUNT(DFT, frames, 1);
 
         // 振幅スペクトルをファイル出力
         snprintf(amp_filename, sizeof(amp_filename), "amp_spectrum_N%d.txt", N);
+        PROF_BEGIN(write_text);
         output_amplitude_spectrum(h, xi, MAX_N, amp_filename);
+        PROF_END(write_text);
     }
 
     return 0;